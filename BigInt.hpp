@@ -3,14 +3,39 @@
 #ifndef BIGINT_HPP
 #define BIGINT_HPP
 
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <climits>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
 #include <exception>
-#include <iomanip>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
 #include <random>
-#include <sstream>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+// <execution> brings the std::execution overloads of product() and sum(). libstdc++ builds its policies on TBB
+// when TBB is installed, which then has to be linked, so there they are only offered if the program included it
+#if __has_include(<execution>) && !defined(_PSTL_PAR_BACKEND_TBB)
+#include <execution>
+#endif
+
+#if defined(__cpp_lib_execution) && (!defined(_PSTL_PAR_BACKEND_TBB) || defined(_GLIBCXX_EXECUTION))
+#define BIGINT_EXECUTION
+#endif
+
 // BIG namespace
 namespace big {
 
@@ -30,12 +55,404 @@ namespace big {
 		std::string _msg;	// Error message
 	};
 
-	typedef int BLOCK;
-	typedef long long BLOCK_PRODUCT;
+	typedef uint32_t BLOCK;
+	typedef uint64_t BLOCK_PRODUCT;
+
+	const BLOCK MIN = 0, MAX = 0xFFFFFFFF;			// Full range of an unsigned 32 bit block
+	const BLOCK_PRODUCT BASE = 0x100000000;			// Base (2^32, used for calculating blocks)
+	const int BITS = 32;					// Bits per block
+
+	const BLOCK DECIMAL_BASE = 1000000000;			// Largest power of 10 that fits in a block (used for decimal conversion)
+	const int DIGITS = 9;					// Decimal digits per DECIMAL_BASE chunk
+
+	const size_t KARATSUBA_THRESHOLD = 32;			// Blocks in the shorter factor before Karatsuba replaces schoolbook
+	const size_t TOOM3_THRESHOLD = 160;			// Blocks in the shorter factor before Toom-3 replaces Karatsuba
+	const size_t NTT_THRESHOLD = 1500;			// Blocks in the shorter factor before the NTT replaces Toom-3
+
+	// NTT primes (k * 2^n + 1, primitive root 3), their product (~2^86) bounds the convolution
+	const BLOCK NTT_PRIME_1 = 998244353;			// 119 * 2^23 + 1
+	const BLOCK NTT_PRIME_2 = 167772161;			// 5 * 2^25 + 1
+	const BLOCK NTT_PRIME_3 = 469762049;			// 7 * 2^26 + 1
+	const size_t NTT_MAX_LENGTH = (size_t)1 << 23;		// Longest transform all three primes support
+
+	const size_t MULTIPLY_GRAIN = 256;			// Default blocks in the shorter factor before a multiplication forks its products
+	const size_t NTT_PARALLEL_LENGTH = (size_t)1 << 16;	// Transform length before the butterflies of each stage are split across threads
+	const size_t REDUCE_GRAIN = 1024;			// Values in a product() or sum() range before its halves are split across threads
+
+	const size_t BURNIKEL_ZIEGLER_THRESHOLD = 100;		// Blocks in the divisor (and quotient) before Burnikel-Ziegler replaces Algorithm D
+
+	const size_t HGCD_THRESHOLD = 500;			// Blocks before the half-GCD replaces Lehmer's algorithm
+
+	const size_t TRIAL_DIVISION_LIMIT = 1024;		// Primes below this are divided out before a primality test
+	const size_t SIEVE_LIMIT = 65536;			// Primes below this are sieved out of next_prime() candidates
+
+	const size_t RADIX_CONVERSION_THRESHOLD = 40;		// Blocks before decimal output splits by powers of 10^9 instead of dividing by 10^9 repeatedly
+
+	const size_t STREAM_CHUNK_LEVEL = 12;			// Streamed decimal I/O works in buffers of 9 * 2^STREAM_CHUNK_LEVEL digits
+	const size_t STREAM_CHUNK = (size_t)DIGITS << STREAM_CHUNK_LEVEL;
+
+	const uint8_t SERIAL_VERSION = 1;			// Version byte of the binary format written by serialize()
+	const size_t SERIAL_HEADER = 12;			// Version, flags, 2 reserved bytes and a 64 bit block count, then the blocks
+
+	const size_t INLINE_BLOCKS = 4;				// Blocks stored inside the object before spilling to the heap (values under 2^128)
+
+	// Rounding direction of a division (see big::divmod)
+	enum class Rounding {
+		TRUNCATE,	// Quotient towards zero, remainder takes the sign of the numerator (built in / and %)
+		FLOOR,		// Quotient towards -infinity, remainder takes the sign of the denominator
+		CEIL,		// Quotient towards +infinity, remainder takes the opposite sign of the denominator
+		EUCLIDEAN	// Remainder is never negative
+	};
+
+	// Order of the words, and of the bytes in each word, for import_words() and export_words() (like mpz_import)
+	enum class Endian {
+		LITTLE,		// Least significant first
+		BIG,		// Most significant first
+		NATIVE		// The host's byte order
+	};
+
+	// Memory resource new blocks of the calling thread are allocated from (nullptr is std::pmr::get_default_resource())
+	inline std::pmr::memory_resource*& block_resource_slot() noexcept {
+		static thread_local std::pmr::memory_resource* resource = nullptr;
+		return resource;
+	}
+
+	// Memory resource new blocks of the calling thread are allocated from
+	inline std::pmr::memory_resource* get_block_resource() noexcept {
+		std::pmr::memory_resource* resource = block_resource_slot();
+		return resource ? resource : std::pmr::get_default_resource();
+	}
+
+	// Sets the memory resource of the calling thread, returns the previous one
+	inline std::pmr::memory_resource* set_block_resource(std::pmr::memory_resource* resource) noexcept {
+		std::pmr::memory_resource* previous = get_block_resource();
+		block_resource_slot() = resource;
+		return previous;
+	}
+
+	// Routes the calling thread's new blocks to a memory resource until the end of the scope
+	class BlockResourceScope {
+	public:
+
+		// Constructor (primary)
+		explicit BlockResourceScope(std::pmr::memory_resource* resource) : _previous(set_block_resource(resource)) { }
+
+		// Deconstructor
+		~BlockResourceScope() {
+			set_block_resource(_previous);
+		}
+
+		BlockResourceScope(const BlockResourceScope&) = delete;
+		BlockResourceScope& operator=(const BlockResourceScope&) = delete;
+	protected:
+	private:
+		std::pmr::memory_resource* _previous;	// Restored when the scope ends
+	};
+
+	// Work-stealing pool behind the parallel multiplication. Every worker pops the newest task of its own deque
+	// and steals the oldest one of another when it runs dry, a thread waiting on fork() runs tasks in the meantime
+	class ThreadPool {
+	public:
+
+		// Constructor (threads counts the forking thread, so threads - 1 workers are started)
+		explicit ThreadPool(unsigned threads);
+
+		// Deconstructor (finishes the queued tasks, then joins the workers)
+		~ThreadPool();
+
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+
+		// Threads that run tasks, the forking thread included
+		unsigned size() const noexcept {
+			return (unsigned)_workers.size() + 1;
+		}
+
+		/**
+		* Fork
+		*
+		* Runs f(0), ..., f(n - 1) in parallel and returns once all of them are done
+		* The calling thread runs f(0) itself, the first exception thrown by a task is rethrown
+		*/
+		template <class F>
+		void fork(size_t n, const F& f);
+	protected:
+	private:
+		struct Join {
+			std::atomic<size_t> pending;	// Tasks of the fork still running
+			std::exception_ptr error;	// First exception thrown by one of them
+			std::mutex lock;		// Guards error
+		};
+
+		struct Task {
+			void (*call)(const void*, size_t);	// Calls *f with the index
+			const void* f;
+			size_t index;
+			Join* join;
+		};
+
+		struct Queue {
+			std::mutex lock;
+			std::deque<Task> tasks;
+		};
+
+		// Calls a fork()'s function object
+		template <class F>
+		static void call(const void* f, size_t index) {
+			(*static_cast<const F*>(f))(index);
+		}
+
+		void push(const Task& task);
+		bool pop(Task& task);
+		void run(const Task& task);
+		void work(size_t index);
+
+		std::vector<std::unique_ptr<Queue>> _queues;	// One per worker, the last is shared by threads outside the pool
+		std::vector<std::thread> _workers;
+		std::atomic<size_t> _queued;			// Tasks in all the queues
+		std::mutex _idle_lock;				// Idle workers sleep on _idle until a push or the shutdown
+		std::condition_variable _idle;
+		bool _stop;
+
+		inline static thread_local const ThreadPool* _current = nullptr;	// Pool the calling thread works for
+		inline static thread_local size_t _current_index = 0;			// and its queue there
+	};
+
+	// Pool of the parallel multiplication (empty while multiplication is serial)
+	inline std::unique_ptr<ThreadPool>& multiply_pool_slot() noexcept {
+		static std::unique_ptr<ThreadPool> pool;
+		return pool;
+	}
+
+	// Pool of the parallel multiplication, nullptr while multiplication is serial
+	inline ThreadPool* multiply_pool() noexcept {
+		return multiply_pool_slot().get();
+	}
+
+	// Threads one multiplication may use, the calling thread included
+	inline unsigned get_multiply_threads() noexcept {
+		ThreadPool* pool = multiply_pool();
+		return pool ? pool->size() : 1;
+	}
+
+	// Sets the threads one multiplication may use (1 is serial, 0 one per core), returns the previous count
+	// Shared by every thread, so it must not change while a multiplication is running
+	inline unsigned set_multiply_threads(unsigned threads) {
+		unsigned previous = get_multiply_threads();
+		if (threads == 0) { threads = std::max(1u, std::thread::hardware_concurrency()); }
+
+		multiply_pool_slot().reset();
+		if (threads > 1) { multiply_pool_slot() = std::make_unique<ThreadPool>(threads); }
+		return previous;
+	}
+
+	// Blocks in the shorter factor below which a multiplication stays serial
+	inline std::atomic<size_t>& multiply_grain_slot() noexcept {
+		static std::atomic<size_t> grain(MULTIPLY_GRAIN);
+		return grain;
+	}
+
+	// Blocks in the shorter factor below which a multiplication stays serial
+	inline size_t get_multiply_grain() noexcept {
+		return multiply_grain_slot().load(std::memory_order_relaxed);
+	}
+
+	// Sets the blocks in the shorter factor below which a multiplication stays serial, returns the previous grain
+	inline size_t set_multiply_grain(size_t blocks) noexcept {
+		return multiply_grain_slot().exchange(blocks, std::memory_order_relaxed);
+	}
+
+	// Block storage, a std::vector<BLOCK> look-alike that keeps up to INLINE_BLOCKS blocks inline
+	// and allocates the rest from a std::pmr::memory_resource, following the std::pmr container rules:
+	// copies use get_block_resource(), moves take the resource along, assignments keep their own
+	class BlockVector {
+	public:
+		typedef BLOCK value_type;
+		typedef BLOCK* iterator;
+		typedef const BLOCK* const_iterator;
+
+		// Constructor (empty)
+		explicit BlockVector(std::pmr::memory_resource* resource = get_block_resource()) noexcept
+			: _data(_inline), _size(0), _capacity(INLINE_BLOCKS), _resource(resource) { }
+
+		// Constructor (n copies of value)
+		explicit BlockVector(size_t n, BLOCK value = 0, std::pmr::memory_resource* resource = get_block_resource()) : BlockVector(resource) {
+			assign(n, value);
+		}
+
+		// Copy Constructor
+		BlockVector(const BlockVector& o, std::pmr::memory_resource* resource = get_block_resource()) : BlockVector(resource) {
+			assign(o.begin(), o.end());
+		}
+
+		// Move Constructor (heap blocks and the resource are taken, inline blocks are copied)
+		BlockVector(BlockVector&& o) noexcept : BlockVector(o._resource) {
+			steal(o);
+		}
+
+		// Deconstructor
+		~BlockVector() {
+			release();
+		}
+
+		// Copy Assignment
+		BlockVector& operator=(const BlockVector& o) {
+			if (this != &o) { assign(o.begin(), o.end()); }
+			return *this;
+		}
+
+		// Move Assignment (copies when the resources differ, *this keeps its own)
+		BlockVector& operator=(BlockVector&& o) {
+			if (this == &o) { return *this; }
+
+			if (*_resource == *o._resource) {
+				release();
+				steal(o);
+			}
+			else {
+				assign(o.begin(), o.end());
+			}
+			return *this;
+		}
+
+		// Element access
+		BLOCK& operator[](size_t i) { return _data[i]; }
+		const BLOCK& operator[](size_t i) const { return _data[i]; }
+		BLOCK& back() { return _data[_size - 1]; }
+		const BLOCK& back() const { return _data[_size - 1]; }
+		BLOCK* data() noexcept { return _data; }
+		const BLOCK* data() const noexcept { return _data; }
+
+		// Iterators
+		iterator begin() noexcept { return _data; }
+		iterator end() noexcept { return _data + _size; }
+		const_iterator begin() const noexcept { return _data; }
+		const_iterator end() const noexcept { return _data + _size; }
+
+		// Capacity
+		size_t size() const noexcept { return _size; }
+		size_t capacity() const noexcept { return _capacity; }
+		bool empty() const noexcept { return _size == 0; }
+		bool is_inline() const noexcept { return _data == _inline; }
+
+		// Resource the heap blocks come from
+		std::pmr::memory_resource* resource() const noexcept { return _resource; }
+
+		// Grows the capacity to at least n, keeping the blocks
+		void reserve(size_t n) {
+			if (n <= _capacity) { return; }
+
+			BLOCK* grown = static_cast<BLOCK*>(_resource->allocate(n * sizeof(BLOCK), alignof(BLOCK)));
+			std::copy(_data, _data + _size, grown);
+			deallocate();
+			_data = grown;
+			_capacity = n;
+		}
+
+		// Resizes to n blocks, new blocks are set to value
+		void resize(size_t n, BLOCK value = 0) {
+			if (n > _capacity) { reserve(std::max(n, 2 * _capacity)); }
+			if (n > _size) { std::fill(_data + _size, _data + n, value); }
+			_size = n;
+		}
+
+		// Replaces the contents with n copies of value
+		void assign(size_t n, BLOCK value) {
+			_size = 0;
+			resize(n, value);
+		}
+
+		// Replaces the contents with [first, last), which must not point into *this
+		void assign(const BLOCK* first, const BLOCK* last) {
+			size_t n = last - first;
+			_size = 0;
+			reserve(n);
+			std::copy(first, last, _data);
+			_size = n;
+		}
+
+		void push_back(BLOCK value) {
+			if (_size == _capacity) { reserve(2 * _capacity); }
+			_data[_size++] = value;
+		}
 
-	const BLOCK MIN = 0, MAX = 999999999;	// 0 to 1 billion
-	const BLOCK BASE = 1000000000;		// Base (used for calculating blocks)
-	const int DIGITS = 9;
+		void pop_back() { --_size; }
+		void clear() noexcept { _size = 0; }
+
+		// Inserts n copies of value before pos
+		iterator insert(const_iterator pos, size_t n, BLOCK value) {
+			size_t at = pos - _data, old = _size;
+			resize(_size + n);
+			std::copy_backward(_data + at, _data + old, _data + old + n);
+			std::fill(_data + at, _data + at + n, value);
+			return _data + at;
+		}
+
+		// Swaps the blocks, each side keeps its own resource
+		void swap(BlockVector& o) {
+			if (!is_inline() && !o.is_inline() && *_resource == *o._resource) {
+				std::swap(_data, o._data);
+				std::swap(_size, o._size);
+				std::swap(_capacity, o._capacity);
+				return;
+			}
+
+			BlockVector temp(std::move(o));
+			o = std::move(*this);
+			*this = std::move(temp);
+		}
+	protected:
+	private:
+		BLOCK* _data;			// Either _inline or a heap block of _capacity
+		size_t _size;
+		size_t _capacity;
+		BLOCK _inline[INLINE_BLOCKS];
+		std::pmr::memory_resource* _resource;
+
+		// Hands any heap blocks back to the resource
+		void deallocate() noexcept {
+			if (!is_inline()) { _resource->deallocate(_data, _capacity * sizeof(BLOCK), alignof(BLOCK)); }
+		}
+
+		// Frees any heap blocks and goes back to the (empty) inline storage
+		void release() noexcept {
+			deallocate();
+			_data = _inline;
+			_size = 0;
+			_capacity = INLINE_BLOCKS;
+		}
+
+		// Takes the blocks of o (*this must be released and share its resource), leaving it empty
+		void steal(BlockVector& o) noexcept {
+			if (o.is_inline()) {
+				std::copy(o._data, o._data + o._size, _inline);
+				_size = o._size;
+			}
+			else {
+				_data = o._data;
+				_size = o._size;
+				_capacity = o._capacity;
+				o._data = o._inline;
+				o._capacity = INLINE_BLOCKS;
+			}
+			o._size = 0;
+		}
+	};
+
+	class Integer;
+	struct IntegerDiv;
+	class ModContext;
+	class DecimalReader;
+	class IntegerView;
+	struct IntegerGCD;
+	struct IntegerRoot;
+
+	// Expression templates (see big::lazy)
+	namespace expr {
+		struct Term;
+		struct Evaluator;
+		template <class E> struct Expression;
+	}
 
 	class Integer {
 	public:
@@ -105,6 +522,20 @@ namespace big {
 		*/
 		Integer(const std::string& str);
 
+		/**
+		* std::string_view Constructor
+		*
+		* @param str Decimal digits, optionally preceded by '-', throws on anything else
+		*/
+		Integer(std::string_view str);
+
+		/**
+		* View Constructor
+		*
+		* @param view Blocks to copy into an owning big::Integer
+		*/
+		explicit Integer(IntegerView view);
+
 		/**
 		* Deconstructor
 		*/
@@ -113,10 +544,32 @@ namespace big {
 		/**
 		* Copy Constructor
 		*
-		* @param o (Other) big::Integer object to be copied
+		* @param o (Other) big::Integer object to be copied, the copy allocates from big::get_block_resource()
 		*/
 		Integer(const Integer& o);
 
+		/**
+		* Copy Constructor (Resource)
+		*
+		* @param o (Other) big::Integer object to be copied
+		* @param resource memory resource the copy's BLOCKs are allocated from
+		*/
+		Integer(const Integer& o, std::pmr::memory_resource* resource);
+
+		/**
+		* Resource Constructor
+		*
+		* @param resource memory resource the BLOCKs of this (zero) big::Integer are allocated from
+		*/
+		explicit Integer(std::pmr::memory_resource* resource);
+
+		/**
+		* Move Constructor
+		*
+		* @param o (Other) big::Integer object whose BLOCKs are taken, it is left empty and may only be assigned to or destroyed
+		*/
+		Integer(Integer&& o) noexcept;
+
 		/////////////////
 		// ASSIGNMENTS //
 		/////////////////
@@ -128,6 +581,21 @@ namespace big {
 		*/
 		Integer& operator=(const Integer& o);
 
+		/**
+		* Integer Object Move Assignment
+		*
+		* @param o (Other) Integer object whose BLOCKs are taken, or copied if it uses a different memory resource
+		*/
+		Integer& operator=(Integer&& o);
+
+		/**
+		* Expression Assignment (see big::lazy)
+		*
+		* @param e Expression to be evaluated straight into the BLOCKs of *this
+		*/
+		template <class E>
+		Integer& operator=(const expr::Expression<E>& e);
+
 		/**
 		* Int Assignment
 		*
@@ -184,6 +652,13 @@ namespace big {
 		*/
 		Integer& operator=(const std::string& str);
 
+		/**
+		* std::string_view Assignment
+		*
+		* @param str std::string_view to be used when copying
+		*/
+		Integer& operator=(std::string_view str);
+
 		//////////////
 		// IOSTREAM //
 		//////////////
@@ -193,1368 +668,5707 @@ namespace big {
 		*/
 		friend std::ostream& operator<<(std::ostream& os, const Integer& o);
 
-		//////////////////
-		// INEQUALITIES //
-		//////////////////
-
 		/**
-		* Equivalence Operator Overload
-		*
-		* @param o (Other) Integer object being compared against
+		* Istream Operator Overload
 		*/
-		bool operator==(const Integer& o) const;
+		friend std::istream& operator>>(std::istream& is, Integer& o);
 
 		/**
-		* Not-Equivalence Operator Overload
-		*
-		* @param o (Other) Integer object being compared against
+		* Chunked Decimal Reader
 		*/
-		bool operator!=(const Integer& o) const;
+		friend class DecimalReader;
+
+		////////////
+		// BINARY //
+		////////////
 
 		/**
-		* Less-Than Operator Overload
-		*
-		* @param o (Other) Integer object being compared against
+		* Read-Only View
 		*/
-		bool operator<(const Integer& o) const;
+		friend class IntegerView;
 
 		/**
-		* Greater-Than Operator Overload
-		*
-		* @param o (Other) Integer object being compared against
+		* View Arithmetic
 		*/
-		bool operator>(const Integer& o) const;
+		friend Integer operator+(IntegerView a, IntegerView b);
+		friend Integer operator-(IntegerView a, IntegerView b);
+		friend Integer operator*(IntegerView a, IntegerView b);
 
 		/**
-		* Less-Than or Equal-To Operator Overload
-		*
-		* @param o (Other) Integer object being compared against
+		* Serialization
 		*/
-		bool operator<=(const Integer& o) const;
+		friend size_t serialize(const Integer& x, void* buffer, size_t size);
+		friend size_t deserialize(Integer& x, const void* buffer, size_t size);
+		friend IntegerView view(const void* buffer, size_t size);
 
 		/**
-		* Greater-Than or Equal-To Operator Overload
-		*
-		* @param o (Other) Integer object being compared against
+		* Word Import & Export
 		*/
-		bool operator>=(const Integer& o) const;
-
-		////////////////
-		// ARITHMETIC //
-		////////////////
+		friend void import_words(Integer& x, const void* data, size_t count, size_t size, Endian order, Endian endian);
+		friend size_t export_words(void* data, size_t size, Endian order, Endian endian, const Integer& x);
+		friend size_t export_count(const Integer& x, size_t size);
 
 		/**
-		* Addition Overload
-		*
-		* @param o (Other) Integer object to be used when adding
+		* To Chars
 		*/
-		Integer operator+(const Integer& o) const;
+		friend std::to_chars_result to_chars(char* first, char* last, const Integer& x);
 
 		/**
-		* Subtraction Overload
-		*
-		* @param o (Other) Integer object to be used when subtracting
+		* Max Chars
 		*/
-		Integer operator-(const Integer& o) const;
+		friend size_t max_chars(const Integer& x);
 
 		/**
-		* Multiplication Overload (Object)
-		*
-		* @param o (Other) Integer object to be used when multiplying
+		* From Chars
 		*/
-		Integer operator*(const Integer& o) const;
+		friend std::from_chars_result from_chars(const char* first, const char* last, Integer& value);
+
+		////////////
+		// DIVMOD //
+		////////////
 
 		/**
-		* Multiplication Overload (Block)
-		*
-		* @param n integer to be used when multiplying
+		* Division & Remainder
 		*/
-		Integer operator*(BLOCK n);
+		friend IntegerDiv divmod(const Integer& n, const Integer& d, Rounding mode);
 
 		/**
-		* Division Overload
-		*
-		* @param o (Other) Integer object to be used when dividing
+		* Division & Remainder (In Place)
 		*/
-		Integer operator/(const Integer& o) const;
+		friend void divmod(const Integer& n, const Integer& d, Integer& quot, Integer& rem, Rounding mode);
 
 		/**
-		* Modulo Overload
-		*
-		* @param o (Other) Integer object to be used when finding remainder
+		* Power
 		*/
-		Integer operator%(const Integer& o) const;
+		friend Integer pow(const Integer& base, const Integer& exp);
 
 		/**
-		* Addition & Assignment Overload
-		*
-		* @param o (Other) Integer object to be used when adding
+		* Greatest Common Divisor
 		*/
-		const Integer& operator+=(const Integer& o);
+		friend Integer gcd(const Integer& a, const Integer& b);
 
 		/**
-		* Subtraction & Assignment Overload
-		*
-		* @param o (Other) Integer object to be used when subtracting
+		* Extended GCD
 		*/
-		const Integer& operator-=(const Integer& o);
+		friend IntegerGCD xgcd(const Integer& a, const Integer& b);
 
 		/**
-		*  Multiplication & Assignment Overload (Object)
-		*
-		* @param o (Other) Integer object to be used when multiplying
+		* Square Root and Remainder
 		*/
-		const Integer& operator*=(const Integer& o);
+		friend IntegerRoot sqrtrem(const Integer& n);
 
 		/**
-		*  Multiplication & Assignment Overload (Block)
-		*
-		* @param n integer to be used when multiplying
+		* Integer Root
 		*/
-		const Integer& operator*=(BLOCK n);
+		friend Integer iroot(const Integer& n, size_t k);
 
 		/**
-		* Division & Assignment Overload
-		*
-		* @param o (Other) Integer object to be used when dividing
+		* Perfect Power
 		*/
-		const Integer& operator/=(const Integer& o);
+		friend bool is_perfect_power(const Integer& n, Integer& base, size_t& exp);
 
 		/**
-		* Modulo & Assignment Overload
-		*
-		* @param o (Other) Integer object to be used when finding remainder
+		* Probable Prime
 		*/
-		const Integer& operator%=(const Integer& o);
-
-		///////////
-		// UNARY //
-		///////////
+		friend bool is_probable_prime(const Integer& n, size_t rounds);
 
 		/**
-		* Unary Negative
-		*
-		* @return A negative *this
+		* Next Prime
 		*/
-		Integer operator-() const;
+		friend Integer next_prime(const Integer& n);
 
 		/**
-		* Pre-increment
+		* Random Prime
 		*/
-		Integer operator++(int);
+		friend Integer random_prime(size_t bits);
 
 		/**
-		* Pre-decrement
+		* Random Bits
 		*/
-		Integer operator--(int);
+		template <class Engine>
+		friend Integer random_bits(size_t bits, Engine& engine);
 
 		/**
-		* Post-increment
+		* Random (Bulk)
 		*/
-		const Integer& operator++();
+		template <class Engine>
+		friend void random(Integer* out, size_t count, const Integer& min, const Integer& max, Engine& engine);
 
 		/**
-		* Post-decrement
+		* Product
 		*/
-		const Integer& operator--();
-
-		/////////////
-		// BITWISE //
-		/////////////
+		template <class Iterator>
+		friend Integer product(Iterator first, Iterator last);
 
 		/**
-		* Bitwise And Overload
-		*
-		* @param o (Other) Integer object to be used when performing the AND operation
+		* Sum
 		*/
-		Integer operator&(Integer& o);
+		template <class Iterator>
+		friend Integer sum(Iterator first, Iterator last);
 
-		/*
-		* Bitwise Or Overload
-		*
-		* @param o (Other) Integer object to be used when performing the OR operation
+#ifdef BIGINT_EXECUTION
+		/**
+		* Product (Execution Policy)
 		*/
-		Integer operator|(Integer& o);
+		template <class Policy, class Iterator>
+		friend std::enable_if_t<std::is_execution_policy_v<std::decay_t<Policy>>, Integer> product(Policy&& policy, Iterator first, Iterator last);
 
-		/*
-		* Bitwise Xor Overload
-		*
-		* @param o (Other) Integer object to be used when performing the XOR operation
+		/**
+		* Sum (Execution Policy)
 		*/
-		Integer operator^(Integer& o);
+		template <class Policy, class Iterator>
+		friend std::enable_if_t<std::is_execution_policy_v<std::decay_t<Policy>>, Integer> sum(Policy&& policy, Iterator first, Iterator last);
+#endif
 
 		/**
-		* Shift Left Overload
-		*
-		* @param n Number of shifts
+		* Modular Arithmetic Context
 		*/
-		Integer operator<<(int n);
+		friend class ModContext;
 
-		/**
-		* Shift Right Overload
+		/////////////////
+		// EXPRESSIONS //
+		/////////////////
+
+		/**
+		* Expression Evaluator (see big::lazy)
+		*/
+		friend struct expr::Evaluator;
+
+		//////////////////
+		// INEQUALITIES //
+		//////////////////
+
+		/**
+		* Equivalence Operator Overload
 		*
-		* @param n Number of shifts
+		* @param o (Other) Integer object being compared against
 		*/
-		Integer operator>>(int n);
+		bool operator==(const Integer& o) const;
 
-		//////////
-		// MISC //
-		//////////
+		/**
+		* Not-Equivalence Operator Overload
+		*
+		* @param o (Other) Integer object being compared against
+		*/
+		bool operator!=(const Integer& o) const;
 
 		/**
-		* Get Length (Chunk)
+		* Less-Than Operator Overload
 		*
-		* @returns the length of the num vector
+		* @param o (Other) Integer object being compared against
 		*/
-		unsigned int getLength();
+		bool operator<(const Integer& o) const;
 
 		/**
-		* Get Length (Digits)
+		* Greater-Than Operator Overload
 		*
-		* @returns the number of digits in the num vector
+		* @param o (Other) Integer object being compared against
 		*/
-		unsigned int getDigitLength();
+		bool operator>(const Integer& o) const;
+
+		/**
+		* Less-Than or Equal-To Operator Overload
+		*
+		* @param o (Other) Integer object being compared against
+		*/
+		bool operator<=(const Integer& o) const;
+
+		/**
+		* Greater-Than or Equal-To Operator Overload
+		*
+		* @param o (Other) Integer object being compared against
+		*/
+		bool operator>=(const Integer& o) const;
+
+		////////////////
+		// ARITHMETIC //
+		////////////////
+
+		/**
+		* Addition Overload
+		*
+		* @param o (Other) Integer object to be used when adding
+		*/
+		Integer operator+(const Integer& o) const&;
+
+		/**
+		* Addition Overload (Expiring)
+		*
+		* Adds into the BLOCKs of an expiring *this instead of copying them
+		*
+		* @param o (Other) Integer object to be used when adding
+		*/
+		Integer operator+(const Integer& o) &&;
+
+		/**
+		* Addition Overload (Expiring Other)
+		*
+		* @param o (Other) expiring Integer object to be used when adding, the sum is built in its BLOCKs
+		*/
+		Integer operator+(Integer&& o) const&;
+
+		/**
+		* Addition Overload (Both Expiring)
+		*
+		* @param o (Other) expiring Integer object to be used when adding
+		*/
+		Integer operator+(Integer&& o) &&;
+
+		/**
+		* Subtraction Overload
+		*
+		* @param o (Other) Integer object to be used when subtracting
+		*/
+		Integer operator-(const Integer& o) const&;
+
+		/**
+		* Subtraction Overload (Expiring)
+		*
+		* Subtracts from the BLOCKs of an expiring *this instead of copying them
+		*
+		* @param o (Other) Integer object to be used when subtracting
+		*/
+		Integer operator-(const Integer& o) &&;
+
+		/**
+		* Subtraction Overload (Expiring Other)
+		*
+		* @param o (Other) expiring Integer object to be used when subtracting, the difference is built in its BLOCKs
+		*/
+		Integer operator-(Integer&& o) const&;
+
+		/**
+		* Subtraction Overload (Both Expiring)
+		*
+		* @param o (Other) expiring Integer object to be used when subtracting
+		*/
+		Integer operator-(Integer&& o) &&;
+
+		/**
+		* Multiplication Overload (Object)
+		*
+		* @param o (Other) Integer object to be used when multiplying
+		*/
+		Integer operator*(const Integer& o) const;
+
+		/**
+		* Multiplication Overload (Scalar)
+		*
+		* @param n built in integer of any width and signedness to be used when multiplying
+		*/
+		template <class T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+		Integer operator*(T n) const&;
+
+		/**
+		* Multiplication Overload (Scalar, Expiring)
+		*
+		* @param n built in integer to be used when multiplying, the product is built in the BLOCKs of *this
+		*/
+		template <class T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+		Integer operator*(T n) &&;
+
+		/**
+		* Division Overload
+		*
+		* @param o (Other) Integer object to be used when dividing
+		*/
+		Integer operator/(const Integer& o) const;
+
+		/**
+		* Modulo Overload
+		*
+		* @param o (Other) Integer object to be used when finding remainder
+		*/
+		Integer operator%(const Integer& o) const;
+
+		/**
+		* Addition & Assignment Overload
+		*
+		* @param o (Other) Integer object to be used when adding
+		*/
+		const Integer& operator+=(const Integer& o);
+
+		/**
+		* Subtraction & Assignment Overload
+		*
+		* @param o (Other) Integer object to be used when subtracting
+		*/
+		const Integer& operator-=(const Integer& o);
+
+		/**
+		*  Multiplication & Assignment Overload (Object)
+		*
+		* @param o (Other) Integer object to be used when multiplying
+		*/
+		const Integer& operator*=(const Integer& o);
+
+		/**
+		*  Multiplication & Assignment Overload (Scalar)
+		*
+		* @param n built in integer of any width and signedness to be used when multiplying
+		*/
+		template <class T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+		const Integer& operator*=(T n);
+
+		/**
+		* Division & Assignment Overload
+		*
+		* @param o (Other) Integer object to be used when dividing
+		*/
+		const Integer& operator/=(const Integer& o);
+
+		/**
+		* Modulo & Assignment Overload
+		*
+		* @param o (Other) Integer object to be used when finding remainder
+		*/
+		const Integer& operator%=(const Integer& o);
+
+		///////////
+		// UNARY //
+		///////////
+
+		/**
+		* Unary Negative
+		*
+		* @return A negative *this
+		*/
+		Integer operator-() const&;
+
+		/**
+		* Unary Negative (Expiring)
+		*
+		* @return A negative *this, reusing its BLOCKs
+		*/
+		Integer operator-() &&;
+
+		/**
+		* Post-increment
+		*/
+		Integer operator++(int);
+
+		/**
+		* Post-decrement
+		*/
+		Integer operator--(int);
+
+		/**
+		* Pre-increment
+		*/
+		const Integer& operator++();
+
+		/**
+		* Pre-decrement
+		*/
+		const Integer& operator--();
+
+		/////////////
+		// BITWISE //
+		/////////////
+
+		/**
+		* Bitwise And Overload
+		*
+		* @param o (Other) Integer object to be used when performing the AND operation
+		*/
+		Integer operator&(const Integer& o) const&;
+
+		/**
+		* Bitwise And Overload (Expiring)
+		*
+		* @param o (Other) Integer object to be used when performing the AND operation, the result is built in the BLOCKs of *this
+		*/
+		Integer operator&(const Integer& o) &&;
+
+		/**
+		* Bitwise Or Overload
+		*
+		* @param o (Other) Integer object to be used when performing the OR operation
+		*/
+		Integer operator|(const Integer& o) const&;
+
+		/**
+		* Bitwise Or Overload (Expiring)
+		*
+		* @param o (Other) Integer object to be used when performing the OR operation, the result is built in the BLOCKs of *this
+		*/
+		Integer operator|(const Integer& o) &&;
+
+		/**
+		* Bitwise Xor Overload
+		*
+		* @param o (Other) Integer object to be used when performing the XOR operation
+		*/
+		Integer operator^(const Integer& o) const&;
+
+		/**
+		* Bitwise Xor Overload (Expiring)
+		*
+		* @param o (Other) Integer object to be used when performing the XOR operation, the result is built in the BLOCKs of *this
+		*/
+		Integer operator^(const Integer& o) &&;
+
+		/**
+		* Bitwise And & Assignment Overload
+		*
+		* @param o (Other) Integer object to be used when performing the AND operation
+		*/
+		const Integer& operator&=(const Integer& o);
+
+		/**
+		* Bitwise Or & Assignment Overload
+		*
+		* @param o (Other) Integer object to be used when performing the OR operation
+		*/
+		const Integer& operator|=(const Integer& o);
+
+		/**
+		* Bitwise Xor & Assignment Overload
+		*
+		* @param o (Other) Integer object to be used when performing the XOR operation
+		*/
+		const Integer& operator^=(const Integer& o);
+
+		/**
+		* Bitwise Not Overload
+		*
+		* @return ~*this, which is -*this - 1 in two's complement
+		*/
+		Integer operator~() const&;
+
+		/**
+		* Bitwise Not Overload (Expiring)
+		*
+		* @return ~*this, reusing its BLOCKs
+		*/
+		Integer operator~() &&;
+
+		/**
+		* Shift Left Overload
+		*
+		* @param n Number of bits to shift by, *this * 2^n
+		*/
+		Integer operator<<(int n) const&;
+
+		/**
+		* Shift Left Overload (Expiring)
+		*
+		* @param n Number of bits to shift by, the result is built in the BLOCKs of *this
+		*/
+		Integer operator<<(int n) &&;
+
+		/**
+		* Shift Right Overload
+		*
+		* @param n Number of bits to shift by, floor(*this / 2^n)
+		*/
+		Integer operator>>(int n) const&;
+
+		/**
+		* Shift Right Overload (Expiring)
+		*
+		* @param n Number of bits to shift by, the result is built in the BLOCKs of *this
+		*/
+		Integer operator>>(int n) &&;
+
+		/**
+		* Shift Left & Assignment Overload
+		*
+		* @param n Number of bits to shift by, *this * 2^n
+		*/
+		const Integer& operator<<=(int n);
+
+		/**
+		* Shift Right & Assignment Overload
+		*
+		* @param n Number of bits to shift by, floor(*this / 2^n)
+		*/
+		const Integer& operator>>=(int n);
+
+		//////////
+		// MISC //
+		//////////
+
+		/**
+		* Get Length (Chunk)
+		*
+		* @returns the length of the num vector
+		*/
+		unsigned int getLength();
+
+		/**
+		* Get Length (Digits)
+		*
+		* @returns the number of digits in the num vector
+		*/
+		unsigned int getDigitLength();
+
+		/**
+		* Get Chunk
+		*
+		* @returns the chunk at a specified index
+		*/
+		unsigned int getChunk(unsigned int n);
+
+		/**
+		* Get Resource
+		*
+		* @returns the memory resource the BLOCKs are allocated from
+		*/
+		std::pmr::memory_resource* getResource() const;
+
+	protected:
+	private:
+		BlockVector num;		// Magnitude, little-endian base 2^32 blocks
+		bool sign;
+
+		/**
+		* Construct From Unsigned
+		* Sets the blocks of the big::Integer object from a native magnitude (sign is untouched)
+		*/
+		void construct_from_unsigned(unsigned long long n);
+
+		/**
+		* Construct From String
+		* Sets big::Integer object data based on passed std::string or const char*
+		* Throws if str is not decimal digits with an optional leading '-'
+		*/
+		void construct_from_string(std::string_view str);
+
+		/**
+		* Tweak Blocks
+		*
+		* Normalizes the object after an operation (no leading zero blocks, no negative zero)
+		*/
+		void tweak_blocks();
+
+		/**
+		* Trim Leading (zeros)
+		*
+		* Trims any leading zeros that are taking up unnecessary space
+		*/
+		void trim_leading();
+
+		/**
+		* Compare
+		*
+		* @param o (Other) Integer object being compared against
+		* @return <0, 0, >0 when *this is less than, equal to, or greater than o
+		*/
+		int compare(const Integer& o) const;
+
+		/**
+		* Add Signed
+		*
+		* Adds |o| with the sign o_sign to *this (shared by addition and subtraction)
+		*
+		* @param o (Other) Integer object whose magnitude is used
+		* @param o_sign Sign to treat o as having
+		*/
+		void add_signed(const Integer& o, bool o_sign);
+
+		/**
+		* Scalar Magnitude
+		*
+		* @param negative Receives the sign of n
+		* @return |n|, exact for every built in integer (unsigned values above LLONG_MAX included)
+		*/
+		template <class T>
+		static unsigned long long scalar_magnitude(T n, bool& negative);
+
+		/**
+		* Scale
+		*
+		* *this *= factor, negated when negative. A factor that fits in a block is one pass in place
+		*/
+		void scale(unsigned long long factor, bool negative);
+
+		/**
+		* Compare Blocks
+		*
+		* @return <0, 0, >0 when magnitude a is less than, equal to, or greater than magnitude b
+		*/
+		static int compare_blocks(const BLOCK* a, size_t an, const BLOCK* b, size_t bn);
+
+		/**
+		* Add Blocks
+		*
+		* r = a + b, where an >= bn and r holds an blocks (r may alias a or b)
+		*
+		* @return The carry out of the most significant block
+		*/
+		static BLOCK add_blocks(BLOCK* r, const BLOCK* a, size_t an, const BLOCK* b, size_t bn);
+
+		/**
+		* Subtract Blocks
+		*
+		* r = a - b, where an >= bn and r holds an blocks (r may alias a or b)
+		*
+		* @return The borrow out of the most significant block
+		*/
+		static BLOCK sub_blocks(BLOCK* r, const BLOCK* a, size_t an, const BLOCK* b, size_t bn);
+
+		/**
+		* Multiply Block
+		*
+		* r = a * m + carry, where r holds n blocks (r may alias a)
+		*
+		* @return The carry out of the most significant block
+		*/
+		static BLOCK mul_block(BLOCK* r, const BLOCK* a, size_t n, BLOCK m, BLOCK carry);
+
+		/**
+		* Divide Block
+		*
+		* q = a / d, where q holds n blocks (q may alias a)
+		*
+		* @return The remainder
+		*/
+		static BLOCK div_block(BLOCK* q, const BLOCK* a, size_t n, BLOCK d);
+
+		/**
+		* Modulo Block
+		*
+		* @return a mod d, without storing a quotient
+		*/
+		static BLOCK mod_block(const BLOCK* a, size_t n, BLOCK d);
+
+		/**
+		* Multiply Blocks
+		*
+		* r = a * b, where r holds an + bn blocks and does not alias a or b
+		* Picks schoolbook, Karatsuba or Toom-3 based on the operand sizes
+		*/
+		static void mul_blocks(BLOCK* r, const BLOCK* a, size_t an, const BLOCK* b, size_t bn);
+
+		/**
+		* Run Parallel
+		*
+		* Calls f(0), ..., f(n - 1), across the multiply pool when there is one and size reaches the grain
+		* Tasks may run on other threads, so they only write to memory the caller allocated for them
+		*/
+		template <class F>
+		static void run_parallel(size_t n, size_t size, const F& f);
+
+		/**
+		* Multiply Basecase
+		*
+		* Schoolbook r = a * b, O(an * bn)
+		*/
+		static void mul_basecase(BLOCK* r, const BLOCK* a, size_t an, const BLOCK* b, size_t bn);
+
+		/**
+		* Square Basecase
+		*
+		* Schoolbook r = a * a (2n blocks), each cross product a[i] * a[j] is computed once and doubled
+		*/
+		static void sqr_basecase(BLOCK* r, const BLOCK* a, size_t n);
+
+		/**
+		* Add Multiply Blocks
+		*
+		* r += a * b, or r -= a * b when subtract is set, modulo 2^(32 * rn) (rn >= an + bn)
+		*/
+		static void addmul_blocks(BLOCK* r, size_t rn, const BLOCK* a, size_t an, const BLOCK* b, size_t bn, bool subtract);
+
+		/**
+		* Multiply Unbalanced
+		*
+		* r = a * b where an >= 2 * bn, done as bn sized slices of a so every product stays balanced
+		*/
+		static void mul_unbalanced(BLOCK* r, const BLOCK* a, size_t an, const BLOCK* b, size_t bn);
+
+		/**
+		* Multiply Karatsuba
+		*
+		* r = a * b where bn <= an < 2 * bn, three half sized products, O(n^1.585)
+		*/
+		static void mul_karatsuba(BLOCK* r, const BLOCK* a, size_t an, const BLOCK* b, size_t bn);
+
+		/**
+		* Multiply Toom-3
+		*
+		* r = a * b where bn <= an < 2 * bn, five third sized products, O(n^1.465)
+		*/
+		static void mul_toom3(BLOCK* r, const BLOCK* a, size_t an, const BLOCK* b, size_t bn);
+
+		/**
+		* Multiply NTT
+		*
+		* r = a * b with a three prime number theoretic transform and CRT reconstruction, O(n log n)
+		* Exact while an + bn <= NTT_MAX_LENGTH
+		*/
+		static void mul_ntt(BLOCK* r, const BLOCK* a, size_t an, const BLOCK* b, size_t bn);
+
+		/**
+		* NTT Convolve
+		*
+		* fa = a * b (mod P), where fa is zeroed and sized to the transform length
+		*/
+		template <BLOCK P, BLOCK G>
+		static void ntt_convolve(BlockVector& fa, const BLOCK* a, size_t an, const BLOCK* b, size_t bn);
+
+		/**
+		* NTT
+		*
+		* In place forward (or inverse) transform of length len (a power of 2) modulo P
+		*/
+		template <BLOCK P, BLOCK G>
+		static void ntt(BLOCK* a, size_t len, bool invert);
+
+		/**
+		* Power Mod
+		*
+		* @return b^e (mod P)
+		*/
+		template <BLOCK P>
+		static BLOCK pow_mod(BLOCK b, BLOCK_PRODUCT e);
+
+		/**
+		* From Blocks
+		*
+		* @return A positive big::Integer holding the n blocks at p
+		*/
+		static Integer from_blocks(const BLOCK* p, size_t n);
+
+		/**
+		* Sum Terms
+		*
+		* r = the sum of the n terms (each +-a or +-a * b), or r += that sum when accumulate is set,
+		* accumulated in one two's complement buffer and normalized once
+		*/
+		static void sum_terms(Integer& r, const expr::Term* terms, size_t n, bool accumulate);
+
+		/**
+		* Negate Blocks
+		*
+		* a = -a modulo 2^(32 * n), two's complement in place
+		*/
+		static void negate_blocks(BLOCK* a, size_t n);
+
+		/**
+		* Divide Exact
+		*
+		* x /= d, where d is known to divide x (the sign is kept)
+		*/
+		static void divide_exact(Integer& x, BLOCK d);
+
+		/**
+		* Add Shifted
+		*
+		* r[offset..rn) += x, for accumulating interpolated coefficients
+		*/
+		static void add_shifted(BLOCK* r, size_t rn, size_t offset, const Integer& x);
+
+		/**
+		* Divide Blocks
+		*
+		* Knuth's Algorithm D, q = a / b and r = a % b, where an >= bn, b has no leading zero block,
+		* q holds an - bn + 1 blocks and r holds bn blocks (neither may alias a or b)
+		*/
+		static void divmod_blocks(BLOCK* q, BLOCK* r, const BLOCK* a, size_t an, const BLOCK* b, size_t bn);
+
+		/**
+		* Leading Zeros
+		*
+		* @return The number of leading zero bits in a (nonzero) block
+		*/
+		static int leading_zeros(BLOCK x);
+
+		/**
+		* Shift Left Blocks
+		*
+		* r = a << shift, where 0 <= shift < BITS and r holds n blocks (r may alias a)
+		*
+		* @return The bits shifted out of the most significant block
+		*/
+		static BLOCK shl_blocks(BLOCK* r, const BLOCK* a, size_t n, int shift);
+
+		/**
+		* Shift Right Blocks
+		*
+		* r = a >> shift, where 0 <= shift < BITS and r holds n blocks (r may alias a)
+		*
+		* @return The bits shifted out of the least significant block (in the high bits)
+		*/
+		static BLOCK shr_blocks(BLOCK* r, const BLOCK* a, size_t n, int shift);
+
+		/**
+		* Divide Magnitude
+		*
+		* q = |a| / |b| and r = |a| % |b|, picking Algorithm D or Burnikel-Ziegler (b must not be zero)
+		*/
+		static void divmod_magnitude(Integer& q, Integer& r, const Integer& a, const Integer& b);
+
+		/**
+		* Divide Knuth
+		*
+		* q = a / b and r = a % b for positive a and b through divmod_blocks()
+		*/
+		static void divmod_knuth(Integer& q, Integer& r, const Integer& a, const Integer& b);
+
+		/**
+		* Divide Burnikel-Ziegler
+		*
+		* q = a / b and r = a % b for positive a and b, O(M(n) log n) with M(n) the cost of a multiplication
+		*/
+		static void divmod_bz(Integer& q, Integer& r, const Integer& a, const Integer& b);
+
+		/**
+		* Divide 2n by 1n
+		*
+		* Burnikel-Ziegler step, divides a < b * 2^(32n) by a normalized n block b
+		*/
+		static void div_2n_1n(Integer& q, Integer& r, const Integer& a, const Integer& b, size_t n);
+
+		/**
+		* Divide 3n by 2n
+		*
+		* Burnikel-Ziegler step, divides [a12, a3] by b = [b1, b2] where each piece is n blocks
+		*/
+		static void div_3n_2n(Integer& q, Integer& r, const Integer& a12, const Integer& a3, const Integer& b, const Integer& b1, const Integer& b2, size_t n);
+
+		/**
+		* Slice Blocks
+		*
+		* @return A positive big::Integer holding blocks [lo, lo + n) of x (clipped to its length)
+		*/
+		static Integer slice_blocks(const Integer& x, size_t lo, size_t n);
+
+		/**
+		* Shift Blocks
+		*
+		* @return x * 2^(32n)
+		*/
+		static Integer shift_blocks(const Integer& x, size_t n);
+
+		/**
+		* Bitwise Operation
+		*
+		* Applies op to a and b block by block, as if both were infinite two's complement values
+		*
+		* @param op '&', '|' or '^'
+		*/
+		static void bitwise(Integer& r, const Integer& a, const Integer& b, char op);
+
+		////////////
+		// OUTPUT //
+		////////////
+
+		/**
+		* Decimal Power
+		*
+		* 10^(9 * 2^k), cached per thread and shared by every conversion after the first
+		*/
+		static const Integer& decimal_power(size_t k);
+
+		/**
+		* Write Decimal
+		*
+		* Divide and conquer: splits x by decimal_power(k) and writes both halves
+		*
+		* @param x Magnitude to write, below decimal_power(k + 1)
+		* @param width Exact digits to write (zero padded), or 0 for no leading zeros
+		* @return One past the last digit written
+		*/
+		static char* write_decimal(char* out, const Integer& x, size_t k, size_t width);
+
+		/**
+		* Decimal Levels
+		*
+		* @return The smallest k with |x| < decimal_power(k + 1), the top split of write_decimal()
+		*/
+		static size_t decimal_levels(const Integer& x);
+
+		/**
+		* Stream Decimal
+		*
+		* write_decimal() to a stream, splitting until each part fits the STREAM_CHUNK buffer
+		*/
+		static void stream_decimal(std::ostream& os, const Integer& x, size_t k, size_t width, char* buffer);
+
+		/**
+		* Write Decimal Basecase
+		*
+		* Peels off base 10^9 chunks with div_block()
+		*/
+		static char* write_decimal_basecase(char* out, const BLOCK* a, size_t n, size_t width);
+
+		///////////
+		// INPUT //
+		///////////
+
+		/**
+		* Parse Chunk
+		*
+		* @param p Up to DIGITS decimal digits, already validated
+		* @return Their value
+		*/
+		static BLOCK parse_chunk(const char* p, size_t n);
+
+		/**
+		* Parse Decimal
+		*
+		* Divide and conquer: the low 9 * 2^k digits and the rest are parsed separately and joined with decimal_power(k)
+		*
+		* @param r Receives the magnitude of the n validated digits at p
+		*/
+		static void parse_decimal(Integer& r, const char* p, size_t n);
+
+		/**
+		* Parse Decimal Basecase
+		*
+		* Folds in DIGITS digits at a time, num = num * 10^9 + chunk
+		*/
+		static void parse_decimal_basecase(Integer& r, const char* p, size_t n);
+
+		////////////
+		// BINARY //
+		////////////
+
+		/**
+		* Add Views
+		*
+		* @return a + b, or a - b if subtract
+		*/
+		static Integer add_views(IntegerView a, IntegerView b, bool subtract);
+
+		/**
+		* Read Serial Header
+		*
+		* Throws unless buffer starts with a valid header and holds all the blocks it announces
+		*
+		* @return The block count
+		*/
+		static size_t read_serial_header(const unsigned char* buffer, size_t size);
+
+		/**
+		* Little Endian Host
+		*
+		* @return Whether BLOCKs are stored least significant byte first, as the binary format is
+		*/
+		static bool little_endian_host();
+
+		/////////
+		// GCD //
+		/////////
+
+		/**
+		* Cofactor Matrix
+		*
+		* (a', b') = (m00 * a + m01 * b, m10 * a + m11 * b), determinant +-1 so gcd(a', b') == gcd(a, b)
+		*/
+		struct Cofactors;
+
+		/**
+		* GCD Magnitude
+		*
+		* Reduces a >= b >= 0 until b == 0, a is then the GCD. Half-GCD steps while b is long, Lehmer after
+		*
+		* @param t Receives the cofactors of the whole reduction (nullptr for none)
+		*/
+		static void gcd_magnitude(Integer& a, Integer& b, Cofactors* t);
+
+		/**
+		* Half-GCD
+		*
+		* Reduces a >= b >= 0 of n blocks until b has about n / 2 blocks, in O(M(n) log n):
+		* the top halves are reduced recursively and the cofactors applied to the full values, twice
+		*
+		* @param t Receives the cofactors of the reduction
+		*/
+		static void hgcd(Integer& a, Integer& b, Cofactors& t);
+
+		/**
+		* GCD Lehmer
+		*
+		* Reduces a >= b >= 0 until b has at most stop blocks (0 for the GCD), mostly with lehmer_update()
+		*
+		* @param t Cofactors to update (nullptr for none)
+		*/
+		static void gcd_lehmer(Integer& a, Integer& b, Cofactors* t, size_t stop);
+
+		/**
+		* Lehmer Simulate
+		*
+		* Runs Euclid on the top 64 bits of a >= b (b of 3 blocks or more) while Collins' condition guarantees the
+		* quotients are those of a and b. Cofactors alternate in sign, even tells which are negative:
+		* a' = +-(u0 * a - v0 * b), b' = -+(u1 * a - v1 * b)
+		*
+		* @return false if not even one quotient is certain
+		*/
+		static bool lehmer_simulate(const Integer& a, const Integer& b, BLOCK& u0, BLOCK& u1, BLOCK& v0, BLOCK& v1, bool& even);
+
+		/**
+		* Lehmer Update
+		*
+		* Applies the single-block cofactors of lehmer_simulate() to the n blocks of a and b in place, in one pass
+		*/
+		static void lehmer_update(BLOCK* a, BLOCK* b, size_t n, BLOCK u0, BLOCK u1, BLOCK v0, BLOCK v1, bool even);
+
+		/**
+		* Euclid Step
+		*
+		* (a, b) = (b, a mod b), with the cofactors updated
+		*/
+		static void euclid_step(Integer& a, Integer& b, Cofactors* t);
+
+		/**
+		* Apply Cofactors
+		*
+		* (a, b) = m (a, b), then makes both non-negative and a >= b by flipping and swapping rows of m
+		*/
+		static void apply_cofactors(Integer& a, Integer& b, Cofactors& m);
+
+		/**
+		* Compose Cofactors
+		*
+		* t = m * t, the reduction t followed by m
+		*/
+		static void compose_cofactors(Cofactors& t, const Cofactors& m);
+
+		///////////
+		// Roots //
+		///////////
+
+		/**
+		* Bit Length
+		*
+		* @return The number of bits in |x|, 0 for 0
+		*/
+		static size_t bit_length(const Integer& x);
+
+		/**
+		* Trailing Zeros
+		*
+		* @return The number of trailing zero bits in x != 0
+		*/
+		static size_t trailing_zeros(const Integer& x);
+
+		/**
+		* Square Root Magnitude
+		*
+		* r = floor(sqrt(n)) and rem = n - r^2 for n >= 0. The root of the top half, one Newton step on the full
+		* value and a correction from the remainder
+		*/
+		static void sqrt_magnitude(Integer& r, Integer& rem, const Integer& n);
+
+		/**
+		* Root Magnitude
+		*
+		* floor(n^(1/k)) for n >= 0 and k >= 2. A double estimate for roots of up to 32 bits, otherwise the root
+		* of the top bits and Newton steps from above
+		*/
+		static Integer root_magnitude(const Integer& n, size_t k);
+
+		/**
+		* Exact Root
+		*
+		* If x > 1 is a k-th power (k prime), replaces x by its root. Trailing zeros, a check modulo 2^64 (short
+		* roots) or power residues modulo small primes (long roots) rule out most values before any root is taken
+		*
+		* @return true if x was a k-th power
+		*/
+		static bool exact_root(Integer& x, size_t k);
+
+		////////////
+		// Primes //
+		////////////
+
+		/**
+		* Small Primes
+		*
+		* @return The primes below SIEVE_LIMIT, sieved on first use
+		*/
+		static const std::vector<BLOCK>& small_primes();
+
+		/**
+		* Prime Residues
+		*
+		* residues[i] = |n| mod small_primes()[i] for i < count. Primes are multiplied together while the product
+		* fits a block, so each product costs one mod_block() pass over n
+		*/
+		static void prime_residues(const Integer& n, size_t count, BLOCK* residues);
+
+		/**
+		* Jacobi Symbol
+		*
+		* @return (a / n) for an odd n > |a|
+		*/
+		static int jacobi(long long a, const Integer& n);
+
+		/**
+		* Miller-Rabin
+		*
+		* @return true if the modulus of m (odd) is a strong probable prime to base a
+		*/
+		static bool miller_rabin(const ModContext& m, const Integer& a);
+
+		/**
+		* Strong Lucas
+		*
+		* @return true if the modulus of m (odd) is a strong Lucas probable prime with Selfridge's parameters
+		*/
+		static bool strong_lucas(const ModContext& m);
+
+		/**
+		* Probable Prime (Sieved)
+		*
+		* BPSW and rounds random Miller-Rabin bases for an odd n without small factors
+		*/
+		static bool probable_prime(const Integer& n, size_t rounds);
+
+		/**
+		* Fill Random
+		*
+		* Fills n blocks with uniform bits from engine, two blocks per call of a 64 bit engine
+		*/
+		template <class Engine>
+		static void fill_random(BLOCK* p, size_t n, Engine& engine);
+
+		/**
+		* Fill Bits
+		*
+		* r = a uniform value in [0, 2^bits), reusing r's blocks
+		*/
+		template <class Engine>
+		static void fill_bits(Integer& r, size_t bits, Engine& engine);
+
+		///////////////
+		// Reduction //
+		///////////////
+
+		/**
+		* Reduce
+		*
+		* out = the n values from first combined with op(out, value), folded left to right up to leaf values and split
+		* into balanced halves above that. From REDUCE_GRAIN values on, the halves are forked across pool (if not nullptr)
+		*/
+		template <class Iterator, class Op>
+		static void reduce(Integer& out, Iterator first, size_t n, size_t leaf, const Op& op, ThreadPool* pool);
+
+		/**
+		* Reduction Pool
+		*
+		* @return The pool a parallel execution policy runs on, the multiply pool or else a temporary one per core in local
+		*/
+		static ThreadPool* reduction_pool(std::unique_ptr<ThreadPool>& local);
+	};
+
+
+	// Cofactor Matrix
+	struct Integer::Cofactors {
+		Integer m00 = 1, m01 = 0;
+		Integer m10 = 0, m11 = 1;
+	};
+
+
+	// Quotient and remainder of a division (the big::Integer version of std::div_t)
+	struct IntegerDiv {
+		Integer quot;	// Quotient
+		Integer rem;	// Remainder
+	};
+
+	/**
+	* Division & Remainder
+	*
+	* @param n Numerator
+	* @param d Denominator
+	* @param mode Rounding direction of the quotient
+	* @return The quotient and remainder, found with a single division
+	*/
+	IntegerDiv divmod(const Integer& n, const Integer& d, Rounding mode = Rounding::TRUNCATE);
+
+	/**
+	* Division & Remainder (In Place)
+	*
+	* @param n Numerator
+	* @param d Denominator
+	* @param quot Receives the quotient (may be n or d)
+	* @param rem Receives the remainder (may be n or d)
+	* @param mode Rounding direction of the quotient
+	*/
+	void divmod(const Integer& n, const Integer& d, Integer& quot, Integer& rem, Rounding mode = Rounding::TRUNCATE);
+
+	// GCD and the Bezout coefficients of an extended GCD, gcd == a * x + b * y
+	struct IntegerGCD {
+		Integer gcd;	// Greatest common divisor, never negative
+		Integer x;	// Coefficient of a, 0 <= x < |b| / gcd (x = sign(a) if b == 0)
+		Integer y;	// Coefficient of b
+	};
+
+	/**
+	* Greatest Common Divisor
+	*
+	* @return The largest positive divisor of a and b, gcd(0, 0) == 0
+	*/
+	Integer gcd(const Integer& a, const Integer& b);
+
+	/**
+	* Least Common Multiple
+	*
+	* @return The smallest non-negative common multiple of a and b, 0 if either is 0
+	*/
+	Integer lcm(const Integer& a, const Integer& b);
+
+	/**
+	* Extended GCD
+	*
+	* @return gcd(a, b) and x, y with a * x + b * y == gcd(a, b)
+	*/
+	IntegerGCD xgcd(const Integer& a, const Integer& b);
+
+	/**
+	* Modular Inverse
+	*
+	* @return x in [0, m) with a * x == 1 (mod m), throws if m is not positive or gcd(a, m) != 1
+	*/
+	Integer invmod(const Integer& a, const Integer& m);
+
+	// Integer square root and its remainder, n == root * root + rem
+	struct IntegerRoot {
+		Integer root;	// floor(sqrt(n))
+		Integer rem;	// n - root * root, in [0, 2 * root]
+	};
+
+	/**
+	* Square Root and Remainder
+	*
+	* @return floor(sqrt(n)) and n - floor(sqrt(n))^2, throws if n is negative
+	*/
+	IntegerRoot sqrtrem(const Integer& n);
+
+	/**
+	* Integer Square Root
+	*
+	* @return floor(sqrt(n)), throws if n is negative
+	*/
+	Integer isqrt(const Integer& n);
+
+	/**
+	* Integer Root
+	*
+	* @param k Degree of the root, a negative n needs an odd k
+	* @return The k-th root of n rounded toward zero
+	*/
+	Integer iroot(const Integer& n, size_t k);
+
+	/**
+	* Perfect Power
+	*
+	* @return true if n == b^e for some integer b and e >= 2
+	*/
+	bool is_perfect_power(const Integer& n);
+
+	/**
+	* Perfect Power (Base and Exponent)
+	*
+	* @param base Receives b
+	* @param exp Receives the largest e with n == b^e, 1 if n is not a perfect power
+	* @return true if exp >= 2
+	*/
+	bool is_perfect_power(const Integer& n, Integer& base, size_t& exp);
+
+	/**
+	* Probable Prime
+	*
+	* Trial division, then BPSW (a strong probable prime test to base 2 and a strong Lucas test), which no known
+	* composite passes, then rounds more Miller-Rabin tests to random bases
+	*
+	* @param rounds Extra Miller-Rabin rounds
+	* @return false if n is composite (or below 2), true if n is prime or very probably prime
+	*/
+	bool is_probable_prime(const Integer& n, size_t rounds = 0);
+
+	/**
+	* Probable Primes (Batch)
+	*
+	* is_probable_prime() for each of count values, spread over threads threads (0 for one per core)
+	* Runs on the multiply pool when it has that many threads, the first exception thrown by a test is rethrown
+	*
+	* @param results Receives count results
+	*/
+	void is_probable_prime(const Integer* values, size_t count, bool* results, size_t rounds = 0, unsigned threads = 0);
+
+	/**
+	* Next Prime
+	*
+	* @return The smallest probable prime greater than n
+	*/
+	Integer next_prime(const Integer& n);
+
+	/**
+	* Random Prime
+	*
+	* @param bits Length of the prime, at least 2
+	* @return A random probable prime of exactly bits bits
+	*/
+	Integer random_prime(size_t bits);
+
+	/**
+	* Random Engine
+	*
+	* @return The calling thread's engine, seeded once from std::random_device (reseed it for repeatable runs)
+	*/
+	std::mt19937_64& random_engine();
+
+	/**
+	* Random Bits
+	*
+	* @param engine Uniform random bit generator, the calling thread's own engine when left out
+	* @return A uniform value in [0, 2^bits)
+	*/
+	template <class Engine>
+	Integer random_bits(size_t bits, Engine& engine);
+	Integer random_bits(size_t bits);
+
+	/**
+	* Random
+	*
+	* @param engine Uniform random bit generator, the calling thread's own engine when left out
+	* @return A uniform value in [min, max), throws if max <= min
+	*/
+	template <class Engine>
+	Integer random(const Integer& min, const Integer& max, Engine& engine);
+	Integer random(const Integer& min, const Integer& max);
+
+	/**
+	* Random (Bulk)
+	*
+	* Fills out[0, count) with uniform values in [min, max), reusing the blocks already in out
+	*
+	* @param engine Uniform random bit generator, the calling thread's own engine when left out
+	*/
+	template <class Engine>
+	void random(Integer* out, size_t count, const Integer& min, const Integer& max, Engine& engine);
+	void random(Integer* out, size_t count, const Integer& min, const Integer& max);
+
+	/**
+	* Product
+	*
+	* Multiplies the values as a balanced product tree, so every multiplication is between factors of similar size
+	* Subtrees run across the multiply threads (see set_multiply_threads)
+	*
+	* @return The product of the values (1 for an empty range)
+	*/
+	template <class Iterator>
+	Integer product(Iterator first, Iterator last);
+	template <class Range>
+	Integer product(const Range& values);
+
+	/**
+	* Sum
+	*
+	* Adds runs of REDUCE_GRAIN values left to right and the run totals as a balanced tree
+	* Subtrees run across the multiply threads (see set_multiply_threads)
+	*
+	* @return The sum of the values (0 for an empty range)
+	*/
+	template <class Iterator>
+	Integer sum(Iterator first, Iterator last);
+	template <class Range>
+	Integer sum(const Range& values);
+
+#ifdef BIGINT_EXECUTION
+	/**
+	* Product / Sum (Execution Policy)
+	*
+	* Available where the standard library has them (see BIGINT_EXECUTION)
+	* std::execution::seq keeps the tree on the calling thread, any other policy runs it on the multiply threads,
+	* or on a temporary pool with one thread per core while multiplication is serial
+	*/
+	template <class Policy, class Iterator>
+	std::enable_if_t<std::is_execution_policy_v<std::decay_t<Policy>>, Integer> product(Policy&& policy, Iterator first, Iterator last);
+	template <class Policy, class Range>
+	std::enable_if_t<std::is_execution_policy_v<std::decay_t<Policy>>, Integer> product(Policy&& policy, const Range& values);
+	template <class Policy, class Iterator>
+	std::enable_if_t<std::is_execution_policy_v<std::decay_t<Policy>>, Integer> sum(Policy&& policy, Iterator first, Iterator last);
+	template <class Policy, class Range>
+	std::enable_if_t<std::is_execution_policy_v<std::decay_t<Policy>>, Integer> sum(Policy&& policy, const Range& values);
+#endif
+
+	/**
+	* To String
+	*
+	* @return x in decimal
+	*/
+	std::string to_string(const Integer& x);
+
+	/**
+	* To Chars
+	*
+	* Writes x in decimal to [first, last) with no stream or locale, like std::to_chars
+	*
+	* @return One past the last character written, or last with std::errc::value_too_large if x does not fit
+	*/
+	std::to_chars_result to_chars(char* first, char* last, const Integer& x);
+
+	/**
+	* Max Chars
+	*
+	* @return An upper bound of the characters to_chars() writes for x, sign included
+	*/
+	size_t max_chars(const Integer& x);
+
+	/**
+	* From Chars
+	*
+	* Parses an optional '-' and decimal digits from [first, last), like std::from_chars
+	*
+	* @param value Receives the value, unchanged on failure
+	* @return One past the last digit, or first with std::errc::invalid_argument if there are no digits
+	*/
+	std::from_chars_result from_chars(const char* first, const char* last, Integer& value);
+
+
+	// Read-only, non-owning big::Integer: blocks that live somewhere else (an Integer, a memory mapped file,
+	// a network buffer) used as arithmetic inputs without copying. The blocks must outlive the view
+	class IntegerView {
+	public:
+
+		/**
+		* Integer Constructor
+		*
+		* @param x big::Integer whose blocks are viewed
+		*/
+		IntegerView(const Integer& x);
+
+		/**
+		* Blocks Constructor
+		*
+		* @param blocks n little-endian BLOCKs (magnitude), leading zeros are ignored
+		* @param negative Sign of the value
+		*/
+		IntegerView(const BLOCK* blocks, size_t n, bool negative);
+
+		/**
+		* Get Data
+		*/
+		const BLOCK* data() const;
+
+		/**
+		* Get Size
+		*
+		* @return Blocks in the magnitude, without leading zeros (zero has one)
+		*/
+		size_t size() const;
+
+		/**
+		* Get Sign
+		*/
+		bool negative() const;
+
+		/**
+		* Compare
+		*
+		* @return -1, 0 or 1 as this is less than, equal to or greater than o
+		*/
+		int compare(IntegerView o) const;
+	protected:
+	private:
+		const BLOCK* _data;
+		size_t _size;
+		bool _sign;
+	};
+
+	/**
+	* View Arithmetic
+	*
+	* Integer and IntegerView operands mix freely, a view is read in place
+	*/
+	Integer operator+(IntegerView a, IntegerView b);
+	Integer operator-(IntegerView a, IntegerView b);
+	Integer operator*(IntegerView a, IntegerView b);
+
+	/**
+	* View Comparison
+	*/
+	bool operator==(IntegerView a, IntegerView b);
+	bool operator!=(IntegerView a, IntegerView b);
+	bool operator<(IntegerView a, IntegerView b);
+	bool operator>(IntegerView a, IntegerView b);
+	bool operator<=(IntegerView a, IntegerView b);
+	bool operator>=(IntegerView a, IntegerView b);
+
+	/**
+	* Serialized Size
+	*
+	* @return Bytes serialize() writes for x, SERIAL_HEADER + 4 per block
+	*/
+	size_t serialized_size(const Integer& x);
+
+	/**
+	* Serialize
+	*
+	* Writes x in the binary format: version, flags (bit 0 is the sign), 2 zero bytes,
+	* the block count as a little-endian uint64, then the blocks as little-endian uint32s
+	*
+	* @return Bytes written, throws if size is below serialized_size(x)
+	*/
+	size_t serialize(const Integer& x, void* buffer, size_t size);
+
+	/**
+	* Deserialize
+	*
+	* @return Bytes read, throws (leaving x unchanged) if the buffer does not start with a valid serialized big::Integer
+	*/
+	size_t deserialize(Integer& x, const void* buffer, size_t size);
+
+	/**
+	* View
+	*
+	* Points an IntegerView at the blocks of a serialized big::Integer, with no copy.
+	* Throws if the buffer is invalid, not 4-byte aligned, or the host is not little-endian
+	*/
+	IntegerView view(const void* buffer, size_t size);
+
+	/**
+	* Import Words
+	*
+	* Sets x to the magnitude in count words of size bytes each (like mpz_import without nails), x is left positive
+	*
+	* @param order Order of the words
+	* @param endian Order of the bytes inside each word
+	*/
+	void import_words(Integer& x, const void* data, size_t count, size_t size, Endian order, Endian endian);
+
+	/**
+	* Export Words
+	*
+	* Writes |x| as words of size bytes each (like mpz_export without nails), data needs room for export_count(x, size) words
+	*
+	* @return Words written, zero has none
+	*/
+	size_t export_words(void* data, size_t size, Endian order, Endian endian, const Integer& x);
+
+	/**
+	* Export Count
+	*
+	* @return Words of size bytes export_words() writes for x
+	*/
+	size_t export_count(const Integer& x, size_t size);
+
+
+	// Expression templates, opt in with big::lazy()
+	//
+	//	big::Integer r = big::lazy(a) * b + c * d - e;	// One buffer, one normalization
+	//	r += big::lazy(a) * b;				// Fused multiply-accumulate
+	//
+	// Sums, differences and negations of Integers and two-factor products are flattened into a list of terms
+	// and accumulated straight into the destination. A factor that is itself an expression is evaluated first.
+	// Expressions hold references to their operands, so evaluate them in the statement that builds them.
+	namespace expr {
+
+		// One +-a or +-a * b of a flattened expression
+		struct Term {
+			const Integer* a;
+			const Integer* b;	// nullptr for a plain term
+			bool negative;
+		};
+
+		// Terms of an expression and the Integers its nested factors were evaluated into
+		template <size_t TERMS, size_t TEMPS>
+		struct Terms {
+			Term term[TERMS];
+			Integer temp[TEMPS + 1];	// + 1 so it is never empty
+			size_t terms = 0;
+			size_t temps = 0;
+
+			void push(const Integer* a, const Integer* b, bool negative) {
+				term[terms++] = { a, b, negative };
+			}
+		};
+
+		// Base of every expression node (CRTP)
+		template <class E>
+		struct Expression {
+			// Evaluates the whole expression into a new Integer
+			operator Integer() const;
+		};
+
+		template <class E>
+		struct is_expression : std::is_base_of<Expression<E>, E> { };
+
+		// Operand: a reference to an Integer
+		class Ref : public Expression<Ref> {
+		public:
+			static const size_t TERMS = 1, TEMPS = 0;
+
+			explicit Ref(const Integer& x) : _x(x) { }
+
+			template <class C>
+			void collect(C& c, bool negative) const { c.push(&_x, nullptr, negative); }
+
+			template <class C>
+			const Integer& factor(C&) const { return _x; }
+		private:
+			const Integer& _x;
+		};
+
+		// Sum (or difference when NEGATE is set) of two expressions
+		template <class L, class R, bool NEGATE>
+		class Sum : public Expression<Sum<L, R, NEGATE>> {
+		public:
+			static const size_t TERMS = L::TERMS + R::TERMS, TEMPS = L::TEMPS + R::TEMPS;
+
+			Sum(const L& l, const R& r) : _l(l), _r(r) { }
+
+			template <class C>
+			void collect(C& c, bool negative) const {
+				_l.collect(c, negative);
+				_r.collect(c, negative != NEGATE);
+			}
+
+			template <class C>
+			const Integer& factor(C& c) const;
+		private:
+			L _l;
+			R _r;
+		};
+
+		// Negation of an expression
+		template <class E>
+		class Negation : public Expression<Negation<E>> {
+		public:
+			static const size_t TERMS = E::TERMS, TEMPS = E::TEMPS;
+
+			explicit Negation(const E& e) : _e(e) { }
+
+			template <class C>
+			void collect(C& c, bool negative) const { _e.collect(c, !negative); }
+
+			template <class C>
+			const Integer& factor(C& c) const;
+		private:
+			E _e;
+		};
+
+		// Product of two expressions, a single term once both factors are Integers
+		template <class L, class R>
+		class Product : public Expression<Product<L, R>> {
+		public:
+			// A factor that is not an Integer is evaluated (with its own Terms) into a temporary
+			static const size_t TERMS = 1, TEMPS = !std::is_same<L, Ref>::value + !std::is_same<R, Ref>::value;
+
+			Product(const L& l, const R& r) : _l(l), _r(r) { }
+
+			template <class C>
+			void collect(C& c, bool negative) const {
+				const Integer& a = _l.factor(c);
+				const Integer& b = _r.factor(c);
+				c.push(&a, &b, negative);
+			}
+
+			template <class C>
+			const Integer& factor(C& c) const;
+		private:
+			L _l;
+			R _r;
+		};
+
+		// Evaluates expressions into Integers, the one place that reaches into Integer
+		struct Evaluator {
+			// r = e, or r += e / r -= e when accumulate is set (negative for -=)
+			template <class E>
+			static void run(Integer& r, const E& e, bool accumulate, bool negative) {
+				Terms<E::TERMS, E::TEMPS> c;
+				e.collect(c, negative);
+
+				Integer::sum_terms(r, c.term, c.terms, accumulate);
+			}
+
+			// Evaluates e into one of the temporaries of c
+			template <class C, class E>
+			static const Integer& temp(C& c, const E& e) {
+				Integer& t = c.temp[c.temps++];
+				run(t, e, false, false);
+
+				return t;
+			}
+		};
+
+		template <class E>
+		Expression<E>::operator Integer() const {
+			Integer r;
+			Evaluator::run(r, static_cast<const E&>(*this), false, false);
+
+			return r;
+		}
+
+		template <class L, class R, bool NEGATE>
+		template <class C>
+		const Integer& Sum<L, R, NEGATE>::factor(C& c) const { return Evaluator::temp(c, *this); }
+
+		template <class E>
+		template <class C>
+		const Integer& Negation<E>::factor(C& c) const { return Evaluator::temp(c, *this); }
+
+		template <class L, class R>
+		template <class C>
+		const Integer& Product<L, R>::factor(C& c) const { return Evaluator::temp(c, *this); }
+
+		template <class L, class R>
+		using enable_expressions = typename std::enable_if<is_expression<L>::value && is_expression<R>::value>::type;
+
+		// Expression op Expression
+		template <class L, class R, class = enable_expressions<L, R>>
+		Sum<L, R, false> operator+(const L& l, const R& r) { return Sum<L, R, false>(l, r); }
+
+		template <class L, class R, class = enable_expressions<L, R>>
+		Sum<L, R, true> operator-(const L& l, const R& r) { return Sum<L, R, true>(l, r); }
+
+		template <class L, class R, class = enable_expressions<L, R>>
+		Product<L, R> operator*(const L& l, const R& r) { return Product<L, R>(l, r); }
+
+		template <class E, class = enable_expressions<E, E>>
+		Negation<E> operator-(const E& e) { return Negation<E>(e); }
+
+		// Expression op Integer
+		template <class L, class = enable_expressions<L, L>>
+		Sum<L, Ref, false> operator+(const L& l, const Integer& r) { return Sum<L, Ref, false>(l, Ref(r)); }
+
+		template <class L, class = enable_expressions<L, L>>
+		Sum<L, Ref, true> operator-(const L& l, const Integer& r) { return Sum<L, Ref, true>(l, Ref(r)); }
+
+		template <class L, class = enable_expressions<L, L>>
+		Product<L, Ref> operator*(const L& l, const Integer& r) { return Product<L, Ref>(l, Ref(r)); }
+
+		// Integer op Expression
+		template <class R, class = enable_expressions<R, R>>
+		Sum<Ref, R, false> operator+(const Integer& l, const R& r) { return Sum<Ref, R, false>(Ref(l), r); }
+
+		template <class R, class = enable_expressions<R, R>>
+		Sum<Ref, R, true> operator-(const Integer& l, const R& r) { return Sum<Ref, R, true>(Ref(l), r); }
+
+		template <class R, class = enable_expressions<R, R>>
+		Product<Ref, R> operator*(const Integer& l, const R& r) { return Product<Ref, R>(Ref(l), r); }
+
+		// Integer op= Expression, accumulated into r without a temporary
+		template <class E, class = enable_expressions<E, E>>
+		const Integer& operator+=(Integer& r, const E& e) {
+			Evaluator::run(r, e, true, false);
+			return r;
+		}
+
+		template <class E, class = enable_expressions<E, E>>
+		const Integer& operator-=(Integer& r, const E& e) {
+			Evaluator::run(r, e, true, true);
+			return r;
+		}
+	}
+
+	// Expression Assignment
+	template <class E>
+	Integer& Integer::operator=(const expr::Expression<E>& e) {
+		expr::Evaluator::run(*this, static_cast<const E&>(e), false, false);
+
+		return *this;
+	}
+
+
+	/**
+	* Lazy
+	*
+	* Starts an expression template, whole expressions built from it are evaluated in one pass
+	*
+	* @param x Integer to wrap, it must outlive the expression
+	*/
+	inline expr::Ref lazy(const Integer& x) {
+		return expr::Ref(x);
+	}
+
+
+	// Reads a decimal big::Integer in pieces, from any source that fills buffers (a file descriptor, a socket, ...)
+	//
+	//	big::DecimalReader reader;
+	//	while (!reader.done() && (n = read(fd, buffer, sizeof(buffer))) > 0) { reader.feed(buffer, buffer + n); }
+	//	reader.finish(value);
+	//
+	// Digits are parsed STREAM_CHUNK at a time and equal sized pieces are joined like a binary counter,
+	// so the digits are never held all at once and the joins stay balanced
+	class DecimalReader {
+	public:
+
+		/**
+		* Default Constructor
+		*/
+		DecimalReader();
+
+		/**
+		* Feed
+		*
+		* Takes an optional '-' (first character only) and then digits, up to the first other character
+		*
+		* @return One past the last character taken, last unless the number ended inside [first, last)
+		*/
+		const char* feed(const char* first, const char* last);
+
+		/**
+		* Started
+		*
+		* @return Whether any character has been taken
+		*/
+		bool started() const;
+
+		/**
+		* Done
+		*
+		* @return Whether the number has ended, later feeds take nothing
+		*/
+		bool done() const;
+
+		/**
+		* Finish
+		*
+		* Sets value to the number read, the reader then starts over
+		*
+		* @return false (value unchanged) if no digits were read
+		*/
+		bool finish(Integer& value);
+	protected:
+	private:
+		std::string _pending;			// Digits not parsed yet, fewer than STREAM_CHUNK
+		std::vector<Integer> _pieces;		// Parsed pieces, most significant first
+		std::vector<size_t> _levels;		// _pieces[i] holds STREAM_CHUNK * 2^_levels[i] digits
+		bool _started, _negative, _done;
+
+		/**
+		* Push Piece
+		*
+		* Parses the STREAM_CHUNK pending digits and joins pieces of equal length
+		*/
+		void push_piece();
+	};
+
+
+	// Modular arithmetic with a fixed modulus. The reductions are precomputed once, so every
+	// reduction afterwards costs about a multiplication instead of a division:
+	// Barrett for any modulus, Montgomery (odd moduli only) for powmod() and the explicit Montgomery form
+	class ModContext {
+	public:
+
+		/**
+		* Constructor (primary)
+		*
+		* @param modulus Positive modulus every result is reduced by
+		*/
+		explicit ModContext(const Integer& modulus);
+
+		/**
+		* Get Modulus
+		*/
+		const Integer& modulus() const;
+
+		/**
+		* Reduce
+		*
+		* @return x mod modulus, in [0, modulus)
+		*/
+		Integer reduce(const Integer& x) const;
+
+		/**
+		* Modular Multiplication
+		*
+		* @return a * b mod modulus, in [0, modulus)
+		*/
+		Integer mulmod(const Integer& a, const Integer& b) const;
+
+		/**
+		* Modular Exponentiation
+		*
+		* Sliding window exponentiation, in Montgomery form when the modulus is odd.
+		* A negative exponent raises the inverse of base, which must exist
+		*
+		* @param exp Exponent
+		* @return base^exp mod modulus, in [0, modulus)
+		*/
+		Integer powmod(const Integer& base, const Integer& exp) const;
+
+		/**
+		* Has Montgomery Form
+		*
+		* @return Whether the modulus is odd, which Montgomery form needs
+		*/
+		bool montgomery() const;
+
+		/**
+		* To Montgomery Form
+		*
+		* @return x * R mod modulus, where R = 2^(32 * blocks in the modulus)
+		*/
+		Integer to_montgomery(const Integer& x) const;
+
+		/**
+		* From Montgomery Form
+		*
+		* @param x Value in Montgomery form, reduced first when outside [0, modulus)
+		* @return x * R^-1 mod modulus
+		*/
+		Integer from_montgomery(const Integer& x) const;
+
+		/**
+		* Montgomery Multiplication
+		*
+		* @param a, b Values in Montgomery form, reduced first when outside [0, modulus)
+		* @return a * b * R^-1 mod modulus, their product in Montgomery form
+		*/
+		Integer montgomery_mul(const Integer& a, const Integer& b) const;
+	protected:
+	private:
+		friend class Integer;	// Integer::strong_lucas() chains montgomery_product()
+
+		Integer _modulus;
+		size_t _n;		// Blocks in the modulus
+		Integer _mu;		// Barrett constant, floor(2^(64n) / modulus)
+		Integer _r2;		// R^2 mod modulus, takes values into Montgomery form
+		BLOCK _m_inv;		// -modulus^-1 mod 2^32 (Montgomery)
+
+		/**
+		* Montgomery Reduction
+		*
+		* r = t * R^-1 mod modulus for t < modulus * R, t holds 2n + 1 blocks and is overwritten
+		*/
+		void redc(BlockVector& t, Integer& r) const;
+
+		/**
+		* Montgomery Product
+		*
+		* montgomery_mul() without the range checks, a and b must already be in [0, modulus)
+		*/
+		Integer montgomery_product(const Integer& a, const Integer& b) const;
+
+		/**
+		* Reduced
+		*
+		* @return Whether x is in [0, modulus)
+		*/
+		bool reduced(const Integer& x) const;
+
+		/**
+		* Barrett Reduction
+		*
+		* @return x mod modulus for 0 <= x < 2^(64n)
+		*/
+		Integer barrett(const Integer& x) const;
+
+		/**
+		* Require Montgomery
+		*
+		* Throws if the modulus is even
+		*/
+		void require_montgomery() const;
+	};
+
+
+	// Default Constructor
+	Integer::Integer() {
+		num.assign(1, 0);	// Set default value to 0
+		sign = false;
+	}
+
+
+	// Integer Constructor
+	Integer::Integer(int n) {
+		// If n >= 0, sign is 0
+		// If n  < 0, sign is 1
+		sign = n < 0;
+		construct_from_unsigned(sign ? 0ULL - (unsigned long long)n : (unsigned long long)n);
+	}
+
+
+	// Long Constructor
+	Integer::Integer(long n) {
+		sign = n < 0;
+		construct_from_unsigned(sign ? 0ULL - (unsigned long long)n : (unsigned long long)n);
+	}
+
+
+	// LLong Constructor
+	Integer::Integer(long long n) {
+		sign = n < 0;
+		construct_from_unsigned(sign ? 0ULL - (unsigned long long)n : (unsigned long long)n);
+	}
+
+
+	// uInt Constructor
+	Integer::Integer(unsigned int n) {
+		sign = 0;
+		construct_from_unsigned(n);
+	}
+
+
+	// uLong Constructor
+	Integer::Integer(unsigned long n) {
+		sign = 0;
+		construct_from_unsigned(n);
+	}
+
+
+	// uLLong Constructor
+	Integer::Integer(unsigned long long n) {
+		sign = 0;
+		construct_from_unsigned(n);
+	}
+
+
+	// Char Array Constructor
+	Integer::Integer(const char* str) {
+		construct_from_string(str);
+	}
+
+
+	// std::string Constructor
+	Integer::Integer(const std::string& str) {
+		construct_from_string(str);
+	}
+
+
+	// std::string_view Constructor
+	Integer::Integer(std::string_view str) {
+		construct_from_string(str);
+	}
+
+
+	// View Constructor
+	Integer::Integer(IntegerView view) {
+		num.assign(view.data(), view.data() + view.size());
+		sign = view.negative();
+	}
+
+	// Deconstructor
+	Integer::~Integer() {
+		num.clear();
+	}
+
+
+	// Copy Constructor
+	Integer::Integer(const Integer& o) : num(o.num), sign(o.sign) { }
+
+
+	// Copy Constructor (Resource)
+	Integer::Integer(const Integer& o, std::pmr::memory_resource* resource) : num(o.num, resource), sign(o.sign) { }
+
+
+	// Resource Constructor
+	Integer::Integer(std::pmr::memory_resource* resource) : num(1, 0, resource), sign(false) { }
+
+
+	// Move Constructor
+	Integer::Integer(Integer&& o) noexcept : num(std::move(o.num)), sign(o.sign) { }
+
+
+	// Integer Object Assignment
+	Integer& Integer::operator=(const Integer& o) {
+		num = o.num;
+		sign = o.sign;
+
+		return *this;
+	}
+
+
+	// Integer Object Move Assignment
+	Integer& Integer::operator=(Integer&& o) {
+		num = std::move(o.num);
+		sign = o.sign;
+
+		return *this;
+	}
+
+
+	// Int Assignment
+	Integer& Integer::operator=(int n) {
+		sign = n < 0;
+		construct_from_unsigned(sign ? 0ULL - (unsigned long long)n : (unsigned long long)n);
+
+		return *this;
+	}
+
+
+	// Long Assignment
+	Integer& Integer::operator=(long n) {
+		sign = n < 0;
+		construct_from_unsigned(sign ? 0ULL - (unsigned long long)n : (unsigned long long)n);
+
+		return *this;
+	}
+
+
+	// LLong Assignment
+	Integer& Integer::operator=(long long n) {
+		sign = n < 0;
+		construct_from_unsigned(sign ? 0ULL - (unsigned long long)n : (unsigned long long)n);
+
+		return *this;
+	}
+
+
+	// uInt Assignment
+	Integer& Integer::operator=(unsigned int n) {
+		sign = 0;
+		construct_from_unsigned(n);
+
+		return *this;
+	}
+
+
+	// uLong Assignment
+	Integer& Integer::operator=(unsigned long n) {
+		sign = 0;
+		construct_from_unsigned(n);
+
+		return *this;
+	}
+
+
+	// uLLong Assignment
+	Integer& Integer::operator=(unsigned long long n) {
+		sign = 0;
+		construct_from_unsigned(n);
+
+		return *this;
+	}
+
+
+	// Char Array Assignment
+	Integer& Integer::operator=(const char* c) {
+		construct_from_string(c);
+
+		return *this;
+	}
+
+
+	// std::string Assignment
+	Integer& Integer::operator=(const std::string& c) {
+		construct_from_string(c);
+
+		return *this;
+	}
+
+
+	// std::string_view Assignment
+	Integer& Integer::operator=(std::string_view c) {
+		construct_from_string(c);
+
+		return *this;
+	}
+
+
+	// Ostream Operator Overload
+	std::ostream& operator<<(std::ostream& os, const Integer& o) {
+		if (max_chars(o) <= STREAM_CHUNK) {
+			std::string str = to_string(o);
+			os.write(str.data(), str.size());
+
+			return os;
+		}
+
+		// Long values go out a buffer at a time, the full decimal string is never built
+		if (o.sign) { os.put('-'); }
+		std::string buffer(STREAM_CHUNK, '\0');
+		Integer::stream_decimal(os, o, Integer::decimal_levels(o), 0, &buffer[0]);
+
+		return os;
+	}
+
+
+	// Istream Operator Overload
+	std::istream& operator>>(std::istream& is, Integer& o) {
+		std::istream::sentry sentry(is);	// Skips leading whitespace
+		if (!sentry) { return is; }
+
+		// Characters leave the stream buffer only while they belong to the number
+		std::streambuf* sb = is.rdbuf();
+		DecimalReader reader;
+		char buffer[256];
+		size_t n = 0;
+
+		typedef std::char_traits<char> traits;
+		for (traits::int_type c = sb->sgetc();; c = sb->snextc()) {
+			if (traits::eq_int_type(c, traits::eof())) {
+				is.setstate(std::ios_base::eofbit);
+				break;
+			}
+
+			char ch = traits::to_char_type(c);
+			if ((unsigned char)(ch - '0') >= 10 && !(ch == '-' && n == 0 && !reader.started())) { break; }
+
+			buffer[n++] = ch;
+			if (n == sizeof(buffer)) {
+				reader.feed(buffer, buffer + n);
+				n = 0;
+			}
+		}
+		reader.feed(buffer, buffer + n);
+
+		if (!reader.finish(o)) { is.setstate(std::ios_base::failbit); }
+		return is;
+	}
+
+
+	// to_string()
+	std::string to_string(const Integer& n) {
+		std::string str(max_chars(n), '\0');
+		str.resize(to_chars(&str[0], &str[0] + str.size(), n).ptr - str.data());
+		return str;
+	}
+
+
+	// To Chars
+	std::to_chars_result to_chars(char* first, char* last, const Integer& x) {
+		// Too small for the bound, the digits go through a scratch buffer first
+		if ((size_t)(last - first) < max_chars(x)) {
+			std::string str = to_string(x);
+			if (str.size() > (size_t)(last - first)) { return { last, std::errc::value_too_large }; }
+
+			return { std::copy(str.begin(), str.end(), first), std::errc() };
+		}
+
+		if (x.sign) { *first++ = '-'; }
+
+		return { Integer::write_decimal(first, x, Integer::decimal_levels(x), 0), std::errc() };
+	}
+
+
+	// Max Chars
+	size_t max_chars(const Integer& x) {
+		size_t bits = x.num.size() * BITS - Integer::leading_zeros(x.num.back());
+
+		// log10(2) < 0.30103
+		return (size_t)((unsigned long long)bits * 30103 / 100000) + 1 + (x.sign ? 1 : 0);
+	}
+
+
+	// From Chars
+	std::from_chars_result from_chars(const char* first, const char* last, Integer& value) {
+		const char* p = first;
+		bool negative = (p != last && *p == '-');
+		if (negative) { ++p; }
+
+		// The digit run ends at the first non-digit
+		const char* digits = p;
+		while (p != last && (unsigned char)(*p - '0') < 10) { ++p; }
+		if (p == digits) { return { first, std::errc::invalid_argument }; }
+
+		// Leading zeros add nothing
+		while (digits + 1 < p && *digits == '0') { ++digits; }
+
+		Integer::parse_decimal(value, digits, p - digits);
+		value.sign = negative;
+		value.tweak_blocks();
+		return { p, std::errc() };
+	}
+
+
+	// Equivalence Operator Overload
+	bool Integer::operator==(const Integer& o) const {
+		return compare(o) == 0;
+	}
+
+
+	// Not-Equivalence Operator Overload
+	bool Integer::operator!=(const Integer& o) const {
+		return compare(o) != 0;
+	}
+
+
+	// Less-Than Operator Overload
+	bool Integer::operator<(const Integer& o) const {
+		return compare(o) < 0;
+	}
+
+
+	// Greater-Than Operator Overload
+	bool Integer::operator>(const Integer& o) const {
+		return compare(o) > 0;
+	}
+
+
+	// Less-Than or Equal-To Operator Overload
+	bool Integer::operator<=(const Integer& o) const {
+		return compare(o) <= 0;
+	}
+
+
+	// Greater-Than or Equal-To Operator Overload
+	bool Integer::operator>=(const Integer& o) const {
+		return compare(o) >= 0;
+	}
+
+
+	// Addition Overload
+	Integer Integer::operator+(const Integer& o) const& {
+		Integer result = *this;
+		result.add_signed(o, o.sign);
+
+		return result;
+	}
+
+
+	// Addition Overload (Expiring)
+	Integer Integer::operator+(const Integer& o) && {
+		add_signed(o, o.sign);
+
+		return std::move(*this);
+	}
+
+
+	// Addition Overload (Expiring Other)
+	Integer Integer::operator+(Integer&& o) const& {
+		o.add_signed(*this, sign);
+
+		return std::move(o);
+	}
+
+
+	// Addition Overload (Both Expiring)
+	Integer Integer::operator+(Integer&& o) && {
+		add_signed(o, o.sign);
+
+		return std::move(*this);
+	}
+
+
+	// Subtraction Overload
+	Integer Integer::operator-(const Integer& o) const& {
+		Integer result = *this;
+		result.add_signed(o, !o.sign);
+
+		return result;
+	}
+
+
+	// Subtraction Overload (Expiring)
+	Integer Integer::operator-(const Integer& o) && {
+		add_signed(o, !o.sign);
+
+		return std::move(*this);
+	}
+
+
+	// Subtraction Overload (Expiring Other)
+	Integer Integer::operator-(Integer&& o) const& {
+		// *this - o == -o + *this
+		o.sign = !o.sign;
+		o.add_signed(*this, sign);
+		o.tweak_blocks();	// -0 == 0
+
+		return std::move(o);
+	}
+
+
+	// Subtraction Overload (Both Expiring)
+	Integer Integer::operator-(Integer&& o) && {
+		add_signed(o, !o.sign);
+
+		return std::move(*this);
+	}
+
+
+	// Multiplication Overload (Object)
+	Integer Integer::operator*(const Integer& o) const {
+		Integer result;
+		result.num.resize(num.size() + o.num.size());
+
+		mul_blocks(result.num.data(), num.data(), num.size(), o.num.data(), o.num.size());
+
+		// Calculated sign
+		result.sign = sign != o.sign;
+		result.tweak_blocks();
+
+		return result;
+	}
+
+
+	// Multiplication Overload (Scalar)
+	template <class T, std::enable_if_t<std::is_integral_v<T>, int>>
+	Integer Integer::operator*(T n) const& {
+		bool negative;
+		unsigned long long factor = scalar_magnitude(n, negative);	// Factor to be multiplied (scale)
+		if (factor > MAX) {	// Doesn't fit in a single block
+			Integer result = *this;
+			result.scale(factor, negative);
+			return result;
+		}
+
+		Integer result;
+		result.num.resize(num.size());
+
+		BLOCK carry = mul_block(result.num.data(), num.data(), num.size(), (BLOCK)factor, 0);
+		if (carry > 0) { result.num.push_back(carry); }	// Append any hanging carry
+
+		result.sign = sign != negative;
+		result.tweak_blocks();
+
+		return result;
+	}
+
+
+	// Multiplication Overload (Scalar, Expiring)
+	template <class T, std::enable_if_t<std::is_integral_v<T>, int>>
+	Integer Integer::operator*(T n) && {
+		*this *= n;
+
+		return std::move(*this);
+	}
+
+
+	// Division overload
+	Integer Integer::operator/(const Integer& o) const {
+		return divmod(*this, o).quot;
+	}
+
+
+	// Modulo overload
+	Integer Integer::operator%(const Integer& o) const {
+		return divmod(*this, o).rem;
+	}
+
+
+	// Addition & Assignment Overload
+	const Integer& Integer::operator+=(const Integer& o) {
+		add_signed(o, o.sign);
+
+		return *this;
+	}
+
+
+	// Subtraction & Assignment Overload
+	const Integer& Integer::operator-=(const Integer& o) {
+		add_signed(o, !o.sign);
+
+		return *this;
+	}
+
+
+	// Multiplication & Assignment Overload (Object)
+	const Integer& Integer::operator*=(const Integer& o) {
+		size_t an = num.size(), bn = o.num.size();
+		if (&o != this && std::min(an, bn) < KARATSUBA_THRESHOLD) {
+			// Schoolbook in place, most significant block first. Each block is read once and then
+			// replaced by its row of the product, which only lands on blocks that were already read
+			num.resize(an + bn, 0);
+			for (size_t i = an; i-- > 0;) {
+				BLOCK m = num[i];
+				num[i] = 0;
+				addmul_blocks(num.data() + i, an + bn - i, o.num.data(), bn, &m, 1, false);
+			}
+		}
+		else {
+			// The fast products (and squaring, the rows would read o while it is overwritten) need a separate destination
+			BlockVector product(an + bn, 0, num.resource());
+			mul_blocks(product.data(), num.data(), an, o.num.data(), bn);
+			num = std::move(product);
+		}
+
+		sign = sign != o.sign;
+		tweak_blocks();
+
+		return *this;
+	}
+
+
+	// Multiplication & Assignment Overload (Scalar)
+	template <class T, std::enable_if_t<std::is_integral_v<T>, int>>
+	const Integer& Integer::operator*=(T n) {
+		bool negative;
+		unsigned long long factor = scalar_magnitude(n, negative);
+		scale(factor, negative);
+
+		return *this;
+	}
+
+
+	// Division & Assignment Overload
+	const Integer& Integer::operator/=(const Integer& o) {
+		if (o.num.size() == 1 && o.num[0] != 0) {
+			// Short division by a single block, in place
+			div_block(num.data(), num.data(), num.size(), o.num[0]);
+			sign = sign != o.sign;
+			tweak_blocks();
+
+			return *this;
+		}
+
+		*this = divmod(*this, o).quot;
+
+		return *this;
+	}
+
+
+	// Modulo & Assignment Overload
+	const Integer& Integer::operator%=(const Integer& o) {
+		if (o.num.size() == 1 && o.num[0] != 0) {
+			// Short division by a single block, only the remainder is kept (with the sign of *this)
+			num.assign(1, div_block(num.data(), num.data(), num.size(), o.num[0]));
+			tweak_blocks();
+
+			return *this;
+		}
+
+		*this = divmod(*this, o).rem;
+
+		return *this;
+	}
+
+
+	// Unary Negative
+	Integer Integer::operator-() const& {
+		Integer result = *this;
+		result.sign = !sign;
+		result.tweak_blocks();	// -0 == 0
+
+		return result;
+	}
+
+
+	// Unary Negative (Expiring)
+	Integer Integer::operator-() && {
+		sign = !sign;
+		tweak_blocks();	// -0 == 0
+
+		return std::move(*this);
+	}
+
+
+	// Post-increment
+	Integer Integer::operator++(int) {
+		Integer result = *this;
+		*this += 1;
+
+		return result;
+	}
+
+	// Post-decrement
+	Integer Integer::operator--(int) {
+		Integer result = *this;
+		*this -= 1;
+
+		return result;
+	}
+
+	// Pre-increment
+	const Integer& Integer::operator++() {
+		*this += 1;
+
+		return *this;
+	}
+
+	// Pre-decrement
+	const Integer& Integer::operator--() {
+		*this -= 1;
+
+		return *this;
+	}
+
+
+	// Bitwise And Overload
+	Integer Integer::operator&(const Integer& o) const& {
+		Integer result;
+		bitwise(result, *this, o, '&');
+
+		return result;
+	}
+
+
+	// Bitwise And Overload (Expiring)
+	Integer Integer::operator&(const Integer& o) && {
+		bitwise(*this, *this, o, '&');
+
+		return std::move(*this);
+	}
+
+
+	// Bitwise Or Overload
+	Integer Integer::operator|(const Integer& o) const& {
+		Integer result;
+		bitwise(result, *this, o, '|');
+
+		return result;
+	}
+
+
+	// Bitwise Or Overload (Expiring)
+	Integer Integer::operator|(const Integer& o) && {
+		bitwise(*this, *this, o, '|');
+
+		return std::move(*this);
+	}
+
+
+	// Bitwise Xor Overload
+	Integer Integer::operator^(const Integer& o) const& {
+		Integer result;
+		bitwise(result, *this, o, '^');
+
+		return result;
+	}
+
+
+	// Bitwise Xor Overload (Expiring)
+	Integer Integer::operator^(const Integer& o) && {
+		bitwise(*this, *this, o, '^');
+
+		return std::move(*this);
+	}
+
+
+	// Bitwise And & Assignment Overload
+	const Integer& Integer::operator&=(const Integer& o) {
+		bitwise(*this, *this, o, '&');
+
+		return *this;
+	}
+
+
+	// Bitwise Or & Assignment Overload
+	const Integer& Integer::operator|=(const Integer& o) {
+		bitwise(*this, *this, o, '|');
+
+		return *this;
+	}
+
+
+	// Bitwise Xor & Assignment Overload
+	const Integer& Integer::operator^=(const Integer& o) {
+		bitwise(*this, *this, o, '^');
+
+		return *this;
+	}
+
+
+	// Bitwise Not Overload
+	Integer Integer::operator~() const& {
+		Integer result = *this;
+		result.sign = !sign;
+		result -= 1;
+
+		return result;
+	}
+
+
+	// Bitwise Not Overload (Expiring)
+	Integer Integer::operator~() && {
+		sign = !sign;
+		*this -= 1;
+
+		return std::move(*this);
+	}
+
+
+	// Shift Left Overload
+	Integer Integer::operator<<(int n) const& {
+		Integer result = *this;
+		result <<= n;
+
+		return result;
+	}
+
+
+	// Shift Left Overload (Expiring)
+	Integer Integer::operator<<(int n) && {
+		*this <<= n;
+
+		return std::move(*this);
+	}
+
+
+	// Shift Right Overload
+	Integer Integer::operator>>(int n) const& {
+		Integer result = *this;
+		result >>= n;
+
+		return result;
+	}
+
+
+	// Shift Right Overload (Expiring)
+	Integer Integer::operator>>(int n) && {
+		*this >>= n;
+
+		return std::move(*this);
+	}
+
+
+	// Shift Left & Assignment Overload
+	const Integer& Integer::operator<<=(int n) {
+		if (n < 0) {
+			throw IntegerException("Cannot shift by a negative number");
+		}
+
+		size_t whole = n / BITS, len = num.size();
+		int part = n % BITS;
+
+		// Move up by whole blocks and the remaining bits in one pass, top down so it can be done in place
+		num.resize(len + whole + 1);
+		num[len + whole] = shl_blocks(num.data() + whole, num.data(), len, part);
+		std::fill(num.begin(), num.begin() + whole, 0);
+
+		tweak_blocks();
+		return *this;
+	}
+
+
+	// Shift Right & Assignment Overload
+	const Integer& Integer::operator>>=(int n) {
+		if (n < 0) {
+			throw IntegerException("Cannot shift by a negative number");
+		}
+
+		size_t whole = n / BITS, len = num.size();
+		int part = n % BITS;
+
+		if (whole >= len) {
+			// Everything is shifted out, floor leaves -1 for negatives
+			num.assign(1, sign ? 1 : 0);
+			return *this;
+		}
+
+		// Floor rounds negatives away from zero whenever a set bit falls off the end
+		bool lost = std::any_of(num.begin(), num.begin() + whole, [](BLOCK b) { return b != 0; });
+		lost |= shr_blocks(num.data(), num.data() + whole, len - whole, part) != 0;
+		num.resize(len - whole);
+
+		if (sign && lost) {
+			num.push_back(0);
+			for (size_t i = 0; ++num[i] == 0; ++i);
+		}
+
+		tweak_blocks();
+		return *this;
+	}
+
+
+	//  Get Length (Chunk)
+	unsigned int Integer::getLength() {
+		return num.size();
+	}
+
+
+	// Get Length (Digits)
+	unsigned int Integer::getDigitLength() {
+		// Blocks are binary, so the digit count needs the decimal conversion
+		return to_string(*this).length() - (sign ? 1 : 0);
+	}
+
+	// Get Chunk
+	unsigned int Integer::getChunk(unsigned int n) {
+		return num[n];
+	}
+
+
+	// Get Resource
+	std::pmr::memory_resource* Integer::getResource() const {
+		return num.resource();
+	}
+
+
+
+	// Construct From Unsigned
+	void Integer::construct_from_unsigned(unsigned long long n) {
+		num.clear();
+
+		do {
+			num.push_back((BLOCK)n);
+			n >>= BITS;
+		} while (n > 0);
+
+		if (num.size() == 1 && num[0] == 0) { sign = 0; }	// Zero fix
+	}
+
+
+	// Construct From String
+	void Integer::construct_from_string(std::string_view str) {
+		const char* last = str.data() + str.size();
+
+		std::from_chars_result result = from_chars(str.data(), last, *this);
+		if (result.ec != std::errc() || result.ptr != last) {
+			throw IntegerException("Invalid decimal string");
+		}
+	}
+
+
+	// Decimal Power
+	const Integer& Integer::decimal_power(size_t k) {
+		// Built on the default heap, a cached power must outlive any BlockResourceScope it is first used under
+		thread_local std::vector<Integer> powers;
+
+		while (powers.size() <= k) {
+			Integer p(std::pmr::new_delete_resource());
+			if (powers.empty()) { p = DECIMAL_BASE; }
+			else { p = powers.back() * powers.back(); }
+			powers.push_back(std::move(p));
+		}
+
+		return powers[k];
+	}
+
+
+	// Write Decimal
+	char* Integer::write_decimal(char* out, const Integer& x, size_t k, size_t width) {
+		if (k == 0 || x.num.size() < RADIX_CONVERSION_THRESHOLD) { return write_decimal_basecase(out, x.num.data(), x.num.size(), width); }
+
+		const Integer& p = decimal_power(k);
+		if (width == 0 && compare_blocks(x.num.data(), x.num.size(), p.num.data(), p.num.size()) < 0) { return write_decimal(out, x, k - 1, 0); }
+
+		// x = q * 10^(9 * 2^k) + r, where r fills exactly 9 * 2^k digits
+		Integer q, r;
+		divmod_magnitude(q, r, x, p);
+
+		size_t low = (size_t)DIGITS << k;
+		out = write_decimal(out, q, k - 1, width == 0 ? 0 : width - low);
+		return write_decimal(out, r, k - 1, low);
+	}
+
+
+	// Decimal Levels
+	size_t Integer::decimal_levels(const Integer& x) {
+		size_t k = 0;
+		if (x.num.size() >= RADIX_CONVERSION_THRESHOLD) {
+			while (compare_blocks(x.num.data(), x.num.size(), decimal_power(k + 1).num.data(), decimal_power(k + 1).num.size()) >= 0) { ++k; }
+		}
+
+		return k;
+	}
+
+
+	// Stream Decimal
+	void Integer::stream_decimal(std::ostream& os, const Integer& x, size_t k, size_t width, char* buffer) {
+		// Below decimal_power(k + 1) there are at most 9 * 2^(k + 1) digits
+		if (((size_t)DIGITS << (k + 1)) <= STREAM_CHUNK) {
+			char* end = write_decimal(buffer, x, k, width);
+			os.write(buffer, end - buffer);
+			return;
+		}
+
+		const Integer& p = decimal_power(k);
+		if (width == 0 && compare_blocks(x.num.data(), x.num.size(), p.num.data(), p.num.size()) < 0) {
+			stream_decimal(os, x, k - 1, 0, buffer);
+			return;
+		}
+
+		// Same split as write_decimal(), the high part goes out first
+		Integer q, r;
+		divmod_magnitude(q, r, x, p);
+
+		size_t low = (size_t)DIGITS << k;
+		stream_decimal(os, q, k - 1, width == 0 ? 0 : width - low, buffer);
+		stream_decimal(os, r, k - 1, low, buffer);
+	}
+
+
+	// Write Decimal Basecase
+	char* Integer::write_decimal_basecase(char* out, const BLOCK* a, size_t n, size_t width) {
+		// Peel off base 10^9 chunks, least significant first
+		BlockVector chunks;
+		BlockVector rest;
+		rest.assign(a, a + n);
+		size_t len = n;
+		while (len > 0 && rest[len - 1] == 0) { --len; }
+		do {
+			chunks.push_back(div_block(rest.data(), rest.data(), len, DECIMAL_BASE));
+			while (len > 0 && rest[len - 1] == 0) { --len; }
+		} while (len > 0);
+
+		if (width > 0) { chunks.resize(width / DIGITS, 0); }	// Leading zero chunks
+
+		// [1][000000001] == { 1, 1 }, every chunk but an unpadded first one is DIGITS wide
+		size_t top = DIGITS;
+		if (width == 0) {
+			top = 1;
+			for (BLOCK c = chunks.back(); c >= 10; c /= 10) { ++top; }
+		}
+
+		for (size_t i = chunks.size(); i-- > 0;) {
+			BLOCK c = chunks[i];
+			size_t w = (i == chunks.size() - 1) ? top : DIGITS;
+			for (size_t j = w; j-- > 0; c /= 10) { out[j] = (char)('0' + c % 10); }
+			out += w;
+		}
+
+		return out;
+	}
+
+
+	// Parse Chunk
+	BLOCK Integer::parse_chunk(const char* p, size_t n) {
+		BLOCK chunk = 0;
+
+		if (n >= 8) {
+			// Eight digits at once (SWAR): the first digit lands in the low byte, then
+			// neighbouring bytes, pairs and quads are combined as digit * 10 + digit, ... in parallel
+			BLOCK_PRODUCT x = 0;
+			for (int i = 0; i < 8; ++i) { x |= (BLOCK_PRODUCT)(unsigned char)p[i] << (8 * i); }
+			x -= 0x3030303030303030;
+			x = (x * 10 + (x >> 8)) & 0x00FF00FF00FF00FF;
+			x = (x * 100 + (x >> 16)) & 0x0000FFFF0000FFFF;
+			x = (x * 10000 + (x >> 32)) & 0x00000000FFFFFFFF;
+
+			chunk = (BLOCK)x;
+			p += 8, n -= 8;
+		}
+
+		for (; n > 0; ++p, --n) { chunk = chunk * 10 + (BLOCK)(*p - '0'); }
+		return chunk;
+	}
+
+
+	// Parse Decimal
+	void Integer::parse_decimal(Integer& r, const char* p, size_t n) {
+		if (n <= RADIX_CONVERSION_THRESHOLD * DIGITS) {
+			parse_decimal_basecase(r, p, n);
+			return;
+		}
+
+		// Largest k with 9 * 2^k < n, so the low part is at least as long as the high part
+		size_t k = 0;
+		while (((size_t)DIGITS << (k + 1)) < n) { ++k; }
+		size_t low = (size_t)DIGITS << k;
+
+		// r = high * 10^(9 * 2^k) + low
+		Integer lo;
+		parse_decimal(r, p, n - low);
+		parse_decimal(lo, p + n - low, low);
+		r *= decimal_power(k);
+		r += lo;
+	}
+
+
+	// Parse Decimal Basecase
+	void Integer::parse_decimal_basecase(Integer& r, const char* p, size_t n) {
+		r.num.reserve(n / DIGITS + 1);	// log2(10^9) < 32, at most one block per chunk
+		r.num.assign(1, 0);
+		r.sign = false;
+
+		// The first chunk takes the overhang, every other chunk is exactly DIGITS wide
+		size_t len = n % DIGITS;
+		if (len == 0) { len = DIGITS; }
+
+		for (size_t i = 0; i < n; i += len, len = DIGITS) {
+			// num = num * 10^9 + chunk
+			BLOCK chunk = parse_chunk(p + i, len);
+			BLOCK carry = mul_block(r.num.data(), r.num.data(), r.num.size(), DECIMAL_BASE, chunk);
+			if (carry > 0) { r.num.push_back(carry); }
+		}
+
+		r.tweak_blocks();
+	}
+
+
+	// Tweak Blocks
+	void Integer::tweak_blocks() {
+		trim_leading();	// Trim any remaining leading zeros
+
+		// Zero is never negative
+		if (num.size() == 1 && num[0] == 0) { sign = false; }
+	}
+
+
+	// Trim Leading (zeros)
+	void Integer::trim_leading() {
+		while (num.size() > 1 && num.back() == 0) {
+			num.pop_back();
+		}
+
+		if (num.empty()) { num.push_back(0); }
+	}
+
+
+	// Compare
+	int Integer::compare(const Integer& o) const {
+		if (sign && !o.sign) { return -1; }		// Negative vs Positive
+		else if (!sign && o.sign) { return 1; }		// Positive vs Negative
+
+		int cmp = compare_blocks(num.data(), num.size(), o.num.data(), o.num.size());
+		return sign ? -cmp : cmp;	// -Long < -Short
+	}
+
+
+	// Scalar Magnitude
+	template <class T>
+	unsigned long long Integer::scalar_magnitude(T n, bool& negative) {
+		if constexpr (std::is_signed_v<T>) {
+			negative = n < 0;
+			return negative ? 0ULL - (unsigned long long)n : (unsigned long long)n;
+		}
+		else {
+			negative = false;
+			return (unsigned long long)n;
+		}
+	}
+
+
+	// Scale
+	void Integer::scale(unsigned long long factor, bool negative) {
+		if (factor > MAX) {	// Doesn't fit in a single block
+			Integer o(factor);
+			o.sign = negative;
+			*this *= o;
+			return;
+		}
+
+		// Single block, one pass in place
+		BLOCK carry = mul_block(num.data(), num.data(), num.size(), (BLOCK)factor, 0);
+		if (carry > 0) { num.push_back(carry); }
+
+		sign = sign != negative;
+		tweak_blocks();
+	}
+
+
+	// Add Signed
+	void Integer::add_signed(const Integer& o, bool o_sign) {
+		if (sign == o_sign) {
+			// Same sign, magnitudes add
+			if (num.size() < o.num.size()) { num.resize(o.num.size(), 0); }
+
+			BLOCK carry = add_blocks(num.data(), num.data(), num.size(), o.num.data(), o.num.size());
+			if (carry > 0) { num.push_back(carry); }
+		}
+		else if (compare_blocks(num.data(), num.size(), o.num.data(), o.num.size()) >= 0) {
+			// Opposite signs, |*this| >= |o| keeps the sign of *this
+			sub_blocks(num.data(), num.data(), num.size(), o.num.data(), o.num.size());
+		}
+		else {
+			// Opposite signs, |o| > |*this| takes the sign of o
+			size_t len = num.size();
+			num.resize(o.num.size(), 0);
+
+			sub_blocks(num.data(), o.num.data(), o.num.size(), num.data(), len);
+			sign = o_sign;
+		}
+
+		tweak_blocks();
+	}
+
+
+	// Compare Blocks
+	int Integer::compare_blocks(const BLOCK* a, size_t an, const BLOCK* b, size_t bn) {
+		while (an > 0 && a[an - 1] == 0) { --an; }
+		while (bn > 0 && b[bn - 1] == 0) { --bn; }
+
+		if (an != bn) { return an < bn ? -1 : 1; }	// Short < Long
+
+		for (size_t i = an; i-- > 0;) {
+			if (a[i] != b[i]) { return a[i] < b[i] ? -1 : 1; }
+		}
+
+		return 0;	// ==
+	}
+
+
+	// Add Blocks
+	BLOCK Integer::add_blocks(BLOCK* r, const BLOCK* a, size_t an, const BLOCK* b, size_t bn) {
+		BLOCK_PRODUCT carry = 0;
+
+		for (size_t i = 0; i < bn; ++i) {
+			carry += (BLOCK_PRODUCT)a[i] + b[i];
+			r[i] = (BLOCK)carry;
+			carry >>= BITS;
+		}
+
+		for (size_t i = bn; i < an; ++i) {
+			carry += a[i];
+			r[i] = (BLOCK)carry;
+			carry >>= BITS;
+		}
+
+		return (BLOCK)carry;
+	}
+
+
+	// Subtract Blocks
+	BLOCK Integer::sub_blocks(BLOCK* r, const BLOCK* a, size_t an, const BLOCK* b, size_t bn) {
+		BLOCK borrow = 0;
+
+		for (size_t i = 0; i < bn; ++i) {
+			BLOCK_PRODUCT diff = (BLOCK_PRODUCT)a[i] - b[i] - borrow;
+			r[i] = (BLOCK)diff;
+			borrow = (BLOCK)(diff >> BITS) & 1;	// Wrapped around -> borrow
+		}
+
+		for (size_t i = bn; i < an; ++i) {
+			BLOCK_PRODUCT diff = (BLOCK_PRODUCT)a[i] - borrow;
+			r[i] = (BLOCK)diff;
+			borrow = (BLOCK)(diff >> BITS) & 1;
+		}
+
+		return borrow;
+	}
+
+
+	// Multiply Block
+	BLOCK Integer::mul_block(BLOCK* r, const BLOCK* a, size_t n, BLOCK m, BLOCK carry) {
+		BLOCK_PRODUCT prod = carry;
+
+		for (size_t i = 0; i < n; ++i) {
+			prod += (BLOCK_PRODUCT)a[i] * m;
+			r[i] = (BLOCK)prod;
+			prod >>= BITS;
+		}
+
+		return (BLOCK)prod;
+	}
+
+
+	// Divide Block
+	BLOCK Integer::div_block(BLOCK* q, const BLOCK* a, size_t n, BLOCK d) {
+		BLOCK_PRODUCT rem = 0;
+
+		for (size_t i = n; i-- > 0;) {
+			BLOCK_PRODUCT cur = (rem << BITS) | a[i];
+			q[i] = (BLOCK)(cur / d);
+			rem = cur % d;
+		}
+
+		return (BLOCK)rem;
+	}
+
+
+	// Modulo Block
+	BLOCK Integer::mod_block(const BLOCK* a, size_t n, BLOCK d) {
+		BLOCK_PRODUCT rem = 0;
+		for (size_t i = n; i-- > 0;) { rem = ((rem << BITS) | a[i]) % d; }
+
+		return (BLOCK)rem;
+	}
+
+
+	// Multiply Blocks
+	void Integer::mul_blocks(BLOCK* r, const BLOCK* a, size_t an, const BLOCK* b, size_t bn) {
+		if (an < bn) {			// a is always the longer factor
+			std::swap(a, b);
+			std::swap(an, bn);
+		}
+
+		if (a == b && an == bn && an < KARATSUBA_THRESHOLD) { sqr_basecase(r, a, an); }	// The others square through a == b themselves
+		else if (bn < KARATSUBA_THRESHOLD) { mul_basecase(r, a, an, b, bn); }
+		else if (bn >= NTT_THRESHOLD && an + bn <= NTT_MAX_LENGTH) { mul_ntt(r, a, an, b, bn); }
+		else if (an >= 2 * bn) { mul_unbalanced(r, a, an, b, bn); }
+		else if (bn < TOOM3_THRESHOLD) { mul_karatsuba(r, a, an, b, bn); }
+		else { mul_toom3(r, a, an, b, bn); }
+	}
+
+
+	// Run Parallel
+	template <class F>
+	void Integer::run_parallel(size_t n, size_t size, const F& f) {
+		ThreadPool* pool = multiply_pool();
+		if (pool && n > 1 && size >= get_multiply_grain()) {
+			pool->fork(n, f);
+			return;
+		}
+
+		for (size_t i = 0; i < n; ++i) { f(i); }
+	}
+
+
+	// Multiply Basecase
+	void Integer::mul_basecase(BLOCK* r, const BLOCK* a, size_t an, const BLOCK* b, size_t bn) {
+		for (size_t i = 0; i < an + bn; ++i) { r[i] = 0; }
+
+		for (size_t i = 0; i < an; ++i) {
+			// (2^32 - 1)^2 + 2 * (2^32 - 1) == 2^64 - 1, so a row never overflows the product
+			BLOCK_PRODUCT carry = 0;
+			for (size_t j = 0; j < bn; ++j) {
+				carry += (BLOCK_PRODUCT)a[i] * b[j] + r[i + j];
+				r[i + j] = (BLOCK)carry;
+				carry >>= BITS;
+			}
+			r[i + bn] = (BLOCK)carry;
+		}
+	}
+
+
+	// Square Basecase
+	void Integer::sqr_basecase(BLOCK* r, const BLOCK* a, size_t n) {
+		for (size_t i = 0; i < 2 * n; ++i) { r[i] = 0; }
+
+		// Cross products above the diagonal
+		for (size_t i = 0; i + 1 < n; ++i) {
+			BLOCK_PRODUCT m = a[i], carry = 0;
+			for (size_t j = i + 1; j < n; ++j) {
+				carry += a[j] * m + r[i + j];
+				r[i + j] = (BLOCK)carry;
+				carry >>= BITS;
+			}
+			r[i + n] = (BLOCK)carry;
+		}
+
+		// Twice the cross products plus the squares on the diagonal
+		shl_blocks(r, r, 2 * n, 1);
+
+		BLOCK_PRODUCT carry = 0;
+		for (size_t i = 0; i < n; ++i) {
+			BLOCK_PRODUCT square = (BLOCK_PRODUCT)a[i] * a[i];
+
+			carry += (BLOCK_PRODUCT)r[2 * i] + (BLOCK)square;
+			r[2 * i] = (BLOCK)carry;
+			carry >>= BITS;
+
+			carry += (BLOCK_PRODUCT)r[2 * i + 1] + (square >> BITS);
+			r[2 * i + 1] = (BLOCK)carry;
+			carry >>= BITS;
+		}
+	}
+
+
+	// Add Multiply Blocks
+	void Integer::addmul_blocks(BLOCK* r, size_t rn, const BLOCK* a, size_t an, const BLOCK* b, size_t bn, bool subtract) {
+		if (an < bn) {			// a is always the longer factor
+			std::swap(a, b);
+			std::swap(an, bn);
+		}
+
+		if (bn >= KARATSUBA_THRESHOLD) {
+			// Fast product on the side, then one pass over r
+			BlockVector prod(an + bn);
+			mul_blocks(prod.data(), a, an, b, bn);
+			if (subtract) { sub_blocks(r, r, rn, prod.data(), an + bn); }
+			else { add_blocks(r, r, rn, prod.data(), an + bn); }
+			return;
+		}
+
+		// Schoolbook straight into r, one row per block of the shorter factor
+		for (size_t j = 0; j < bn; ++j) {
+			BLOCK* row = r + j;
+			BLOCK_PRODUCT m = b[j], carry = 0;
+
+			if (subtract) {
+				for (size_t i = 0; i < an; ++i) {
+					carry += a[i] * m;
+					BLOCK low = (BLOCK)carry;
+					carry = (carry >> BITS) + (row[i] < low);
+					row[i] -= low;
+				}
+			}
+			else {
+				for (size_t i = 0; i < an; ++i) {
+					carry += a[i] * m + row[i];
+					row[i] = (BLOCK)carry;
+					carry >>= BITS;
+				}
+			}
+
+			// Ripple the carry (or borrow) up until it dies out
+			for (size_t k = j + an; carry != 0 && k < rn; ++k) {
+				BLOCK old = r[k];
+				r[k] = subtract ? old - (BLOCK)carry : old + (BLOCK)carry;
+				carry = subtract ? old < carry : r[k] < carry;
+			}
+		}
+	}
+
+
+	// Multiply Unbalanced
+	void Integer::mul_unbalanced(BLOCK* r, const BLOCK* a, size_t an, const BLOCK* b, size_t bn) {
+		for (size_t i = 0; i < an + bn; ++i) { r[i] = 0; }
+
+		BlockVector slice(2 * bn);
+		for (size_t i = 0; i < an; i += bn) {
+			size_t len = std::min(bn, an - i);
+
+			// r += (a[i..i + len) * b) << i blocks
+			mul_blocks(slice.data(), a + i, len, b, bn);
+			add_blocks(r + i, r + i, an + bn - i, slice.data(), len + bn);
+		}
+	}
+
+
+	// Multiply Karatsuba
+	void Integer::mul_karatsuba(BLOCK* r, const BLOCK* a, size_t an, const BLOCK* b, size_t bn) {
+		// a = a1 * x + a0, b = b1 * x + b0, where x = 2^(32m)
+		// an < 2 * bn keeps b1 from being empty
+		size_t m = an / 2;
+		const BLOCK *a0 = a, *a1 = a + m, *b0 = b, *b1 = b + m;
+		size_t a1n = an - m, b1n = bn - m;
+
+		// (a0 + a1) * (b0 + b1), a square again when a == b
+		bool square = a == b && an == bn;
+		BlockVector sa(a1n + 1), sb(square ? 0 : std::max(m, b1n) + 1);
+		sa[a1n] = add_blocks(sa.data(), a1, a1n, a0, m);
+		if (!square && m >= b1n) { sb[m] = add_blocks(sb.data(), b0, m, b1, b1n); }
+		else if (!square) { sb[b1n] = add_blocks(sb.data(), b1, b1n, b0, m); }
+
+		const BlockVector& sc = square ? sa : sb;
+		BlockVector z1(sa.size() + sc.size());
+
+		// z0 = a0 * b0 and z2 = a1 * b1 fill the low and high halves of r, the three products are independent
+		run_parallel(3, bn, [&](size_t i) {
+			if (i == 0) { mul_blocks(z1.data(), sa.data(), sa.size(), sc.data(), sc.size()); }
+			else if (i == 1) { mul_blocks(r, a0, m, b0, m); }
+			else { mul_blocks(r + 2 * m, a1, a1n, b1, b1n); }
+		});
+
+		// z1 = (a0 + a1) * (b0 + b1) - z0 - z2
+		sub_blocks(z1.data(), z1.data(), z1.size(), r, 2 * m);
+		sub_blocks(z1.data(), z1.data(), z1.size(), r + 2 * m, a1n + b1n);
+
+		// r += z1 * x
+		size_t z1n = z1.size();
+		while (z1n > 0 && z1[z1n - 1] == 0) { --z1n; }
+		add_blocks(r + m, r + m, an + bn - m, z1.data(), z1n);
+	}
+
+
+	// Multiply Toom-3
+	void Integer::mul_toom3(BLOCK* r, const BLOCK* a, size_t an, const BLOCK* b, size_t bn) {
+		// a = a2 * x^2 + a1 * x + a0 (same for b), where x = 2^(32k)
+		// an < 2 * bn keeps b0 and b1 from being empty, b2 may be
+		size_t k = (an + 2) / 3;
+		Integer a0 = from_blocks(a, k), a1 = from_blocks(a + k, k), a2 = from_blocks(a + 2 * k, an - 2 * k);
+		Integer b0 = from_blocks(b, k), b1 = from_blocks(b + k, std::min(k, bn - k)), b2 = from_blocks(b + 2 * k, bn > 2 * k ? bn - 2 * k : 0);
+
+		// Evaluate at 0, 1, -1, -2 and infinity
+		Integer p = a0 + a2, q = b0 + b2;
+		Integer p1 = p + a1, pm1 = p - a1, pm2 = (pm1 + a2) * 2 - a0;
+		Integer q1 = q + b1, qm1 = q - b1, qm2 = (qm1 + b2) * 2 - b0;
+
+		// Squaring evaluates both factors to the same points, multiplying a point by itself squares it
+		bool square = a == b && an == bn;
+		const Integer* factors[5][2] = {
+			{ &a0, square ? &a0 : &b0 }, { &p1, square ? &p1 : &q1 }, { &pm1, square ? &pm1 : &qm1 },
+			{ &pm2, square ? &pm2 : &qm2 }, { &a2, square ? &a2 : &b2 }
+		};
+
+		// The five products are independent, their blocks are sized here so the tasks only fill them
+		Integer products[5];
+		for (size_t i = 0; i < 5; ++i) {
+			products[i].num.resize(factors[i][0]->num.size() + factors[i][1]->num.size());
+		}
+
+		run_parallel(5, bn, [&](size_t i) {
+			const BlockVector &x = factors[i][0]->num, &y = factors[i][1]->num;
+			mul_blocks(products[i].num.data(), x.data(), x.size(), y.data(), y.size());
+		});
+
+		for (size_t i = 0; i < 5; ++i) {
+			products[i].sign = factors[i][0]->sign != factors[i][1]->sign;
+			products[i].tweak_blocks();
+		}
+
+		Integer &r0 = products[0], &r1 = products[1], &rm1 = products[2], &rm2 = products[3], &rinf = products[4];
+
+		// Interpolate (Bodrato's sequence), every division is exact
+		Integer c3 = rm2 - r1;
+		divide_exact(c3, 3);
+		Integer c1 = r1 - rm1;
+		divide_exact(c1, 2);
+		Integer c2 = rm1 - r0;
+		c3 = c2 - c3;
+		divide_exact(c3, 2);
+		c3 += rinf * 2;
+		c2 += c1 - rinf;
+		c1 -= c3;
+
+		// r = r0 + c1 * x + c2 * x^2 + c3 * x^3 + rinf * x^4
+		for (size_t i = 0; i < an + bn; ++i) { r[i] = 0; }
+		add_shifted(r, an + bn, 0, r0);
+		add_shifted(r, an + bn, k, c1);
+		add_shifted(r, an + bn, 2 * k, c2);
+		add_shifted(r, an + bn, 3 * k, c3);
+		add_shifted(r, an + bn, 4 * k, rinf);
+	}
+
+
+	// Multiply NTT
+	void Integer::mul_ntt(BLOCK* r, const BLOCK* a, size_t an, const BLOCK* b, size_t bn) {
+		size_t len = 1;
+		while (len < an + bn) { len <<= 1; }
+
+		// Every coefficient is < bn * 2^64 <= 2^86, so three residues pin it down exactly
+		BlockVector r1(len, 0), r2(len, 0), r3(len, 0);
+		run_parallel(3, bn, [&](size_t i) {
+			if (i == 0) { ntt_convolve<NTT_PRIME_1, 3>(r1, a, an, b, bn); }
+			else if (i == 1) { ntt_convolve<NTT_PRIME_2, 3>(r2, a, an, b, bn); }
+			else { ntt_convolve<NTT_PRIME_3, 3>(r3, a, an, b, bn); }
+		});
+
+		// Garner's CRT: coefficient = x1 + p1 * (t2 + p2 * t3)
+		const BLOCK_PRODUCT p1 = NTT_PRIME_1, p2 = NTT_PRIME_2, p3 = NTT_PRIME_3;
+		const BLOCK_PRODUCT inv_p1 = pow_mod<NTT_PRIME_2>(p1 % p2, p2 - 2);			// p1^-1 (mod p2)
+		const BLOCK_PRODUCT inv_p1p2 = pow_mod<NTT_PRIME_3>(p1 % p3 * (p2 % p3) % p3, p3 - 2);	// (p1 * p2)^-1 (mod p3)
+
+		BLOCK_PRODUCT carry_lo = 0, carry_hi = 0;	// Running carry, carry_lo + carry_hi * 2^32
+		for (size_t k = 0; k < an + bn; ++k) {
+			BLOCK_PRODUCT x1 = r1[k], x2 = r2[k], x3 = r3[k];
+			BLOCK_PRODUCT t2 = (x2 + p2 - x1 % p2) % p2 * inv_p1 % p2;
+			BLOCK_PRODUCT t3 = (x3 + p3 - (x1 + p1 % p3 * t2) % p3) % p3 * inv_p1p2 % p3;
+			BLOCK_PRODUCT u = t2 + p2 * t3;		// < 2^57
+
+			// Add x1 + p1 * u (~86 bits) to the carry in 32 bit pieces
+			BLOCK_PRODUCT lo = p1 * (u & MAX), hi = p1 * (u >> BITS);
+			BLOCK_PRODUCT sum = carry_lo + x1 + (lo & MAX);
+			r[k] = (BLOCK)sum;
+
+			BLOCK_PRODUCT next = (sum >> BITS) + (lo >> BITS) + hi + carry_hi;
+			carry_lo = next & MAX;
+			carry_hi = next >> BITS;
+		}
+	}
+
+
+	// NTT Convolve
+	template <BLOCK P, BLOCK G>
+	void Integer::ntt_convolve(BlockVector& fa, const BLOCK* a, size_t an, const BLOCK* b, size_t bn) {
+		size_t len = fa.size();
+		bool square = a == b && an == bn;	// One forward transform is enough
+		BlockVector fb(square ? 0 : len, 0);
+
+		for (size_t i = 0; i < an; ++i) { fa[i] = a[i] % P; }
+		ntt<P, G>(fa.data(), len, false);
+
+		if (!square) {
+			for (size_t i = 0; i < bn; ++i) { fb[i] = b[i] % P; }
+			ntt<P, G>(fb.data(), len, false);
+		}
+
+		const BLOCK* fc = square ? fa.data() : fb.data();
+		for (size_t i = 0; i < len; ++i) {
+			fa[i] = (BLOCK)((BLOCK_PRODUCT)fa[i] * fc[i] % P);
+		}
+
+		ntt<P, G>(fa.data(), len, true);
+	}
+
+
+	// NTT
+	template <BLOCK P, BLOCK G>
+	void Integer::ntt(BLOCK* a, size_t len, bool invert) {
+		// Bit reversal permutation
+		for (size_t i = 1, j = 0; i < len; ++i) {
+			size_t bit = len >> 1;
+			for (; j & bit; bit >>= 1) { j ^= bit; }
+			j ^= bit;
+
+			if (i < j) { std::swap(a[i], a[j]); }
+		}
+
+		// Iterative Cooley-Tukey butterflies, each stage split into chunks of its len / 2 butterflies on long transforms
+		ThreadPool* pool = multiply_pool();
+		size_t chunks = pool && len >= NTT_PARALLEL_LENGTH ? pool->size() : 1;
+
+		BlockVector twiddle(len / 2 + 1);
+		for (size_t half = 1, shift = 0; half < len; half <<= 1, ++shift) {
+			BLOCK w = pow_mod<P>(G, (P - 1) / (2 * half));
+			if (invert) { w = pow_mod<P>(w, P - 2); }
+
+			twiddle[0] = 1;
+			for (size_t j = 1; j < half; ++j) {
+				twiddle[j] = (BLOCK)((BLOCK_PRODUCT)twiddle[j - 1] * w % P);
+			}
+
+			run_parallel(chunks, len, [&](size_t c) {
+				// Butterfly t pairs a[i + j] with a[i + j + half], where i = t / half * 2 * half and j = t % half
+				size_t first = len / 2 * c / chunks, last = len / 2 * (c + 1) / chunks;
+
+				for (size_t t = first; t < last;) {
+					size_t i = (t >> shift) << (shift + 1), j = t & (half - 1), stop = std::min(half, j + (last - t));
+					t += stop - j;
+
+					for (; j < stop; ++j) {
+						BLOCK u = a[i + j];
+						BLOCK v = (BLOCK)((BLOCK_PRODUCT)a[i + j + half] * twiddle[j] % P);
+
+						a[i + j] = u + v >= P ? u + v - P : u + v;		// P < 2^31, so no wrap around
+						a[i + j + half] = u >= v ? u - v : u + P - v;
+					}
+				}
+			});
+		}
+
+		if (invert) {
+			BLOCK_PRODUCT inv_len = pow_mod<P>((BLOCK)(len % P), P - 2);
+			for (size_t i = 0; i < len; ++i) {
+				a[i] = (BLOCK)(a[i] * inv_len % P);
+			}
+		}
+	}
+
+
+	// Power Mod
+	template <BLOCK P>
+	BLOCK Integer::pow_mod(BLOCK b, BLOCK_PRODUCT e) {
+		BLOCK_PRODUCT result = 1, base = b % P;
+
+		while (e > 0) {
+			if (e & 1) { result = result * base % P; }
+			base = base * base % P;
+			e >>= 1;
+		}
+
+		return (BLOCK)result;
+	}
+
+
+	// From Blocks
+	Integer Integer::from_blocks(const BLOCK* p, size_t n) {
+		Integer result;
+		if (n > 0) { result.num.assign(p, p + n); }
+
+		result.tweak_blocks();
+		return result;
+	}
+
+
+	// Divide Exact
+	void Integer::divide_exact(Integer& x, BLOCK d) {
+		div_block(x.num.data(), x.num.data(), x.num.size(), d);
+		x.tweak_blocks();
+	}
+
+
+	// Add Shifted
+	void Integer::add_shifted(BLOCK* r, size_t rn, size_t offset, const Integer& x) {
+		if (x.num.size() == 1 && x.num[0] == 0) { return; }	// Nothing to add (and offset may be past rn)
+
+		// Coefficients of a product of positive factors are never negative, and x * 2^(32 * offset) <= r
+		add_blocks(r + offset, r + offset, rn - offset, x.num.data(), x.num.size());
+	}
+
+
+	// Divide Blocks
+	void Integer::divmod_blocks(BLOCK* q, BLOCK* r, const BLOCK* a, size_t an, const BLOCK* b, size_t bn) {
+		if (bn == 1) {			// Short division
+			r[0] = div_block(q, a, an, b[0]);
+			return;
+		}
+
+		// Normalize so the top block of the divisor has its high bit set, which keeps qhat at most 2 too large
+		int shift = leading_zeros(b[bn - 1]);
+		BlockVector u(an + 1), v(bn);
+
+		shl_blocks(v.data(), b, bn, shift);
+		u[an] = shl_blocks(u.data(), a, an, shift);
+
+		for (size_t j = an - bn + 1; j-- > 0;) {
+			// Estimate the quotient block from the top two blocks of the remainder
+			BLOCK_PRODUCT top = ((BLOCK_PRODUCT)u[j + bn] << BITS) | u[j + bn - 1];
+			BLOCK_PRODUCT qhat = top / v[bn - 1], rhat = top % v[bn - 1];
+
+			// Refine it with the next block, this catches nearly every overestimate
+			while (qhat > MAX || qhat * v[bn - 2] > ((rhat << BITS) | u[j + bn - 2])) {
+				--qhat;
+				rhat += v[bn - 1];
+				if (rhat > MAX) { break; }
+			}
+
+			// u[j..j + bn] -= qhat * v
+			BLOCK_PRODUCT carry = 0;
+			BLOCK borrow = 0;
+			for (size_t i = 0; i < bn; ++i) {
+				BLOCK_PRODUCT prod = qhat * v[i] + carry;
+				carry = prod >> BITS;
+
+				BLOCK_PRODUCT diff = (BLOCK_PRODUCT)u[i + j] - (BLOCK)prod - borrow;
+				u[i + j] = (BLOCK)diff;
+				borrow = (BLOCK)(diff >> BITS) & 1;
+			}
+			BLOCK_PRODUCT diff = (BLOCK_PRODUCT)u[j + bn] - carry - borrow;
+			u[j + bn] = (BLOCK)diff;
+
+			// Went negative, qhat was still one too large so add a v back
+			if ((diff >> BITS) & 1) {
+				--qhat;
+				u[j + bn] += add_blocks(u.data() + j, u.data() + j, bn, v.data(), bn);
+			}
+
+			q[j] = (BLOCK)qhat;
+		}
+
+		// Undo the normalization on the remainder (u[bn] is zero by now)
+		shr_blocks(r, u.data(), bn, shift);
+		if (shift > 0) { r[bn - 1] |= u[bn] << (BITS - shift); }
+	}
+
+
+	// Leading Zeros
+	int Integer::leading_zeros(BLOCK x) {
+		int count = 0;
+		for (int step = BITS / 2; step > 0; step /= 2) {
+			if ((x >> (BITS - step)) == 0) {
+				count += step;
+				x <<= step;
+			}
+		}
+
+		return count;
+	}
+
+
+	// Shift Left Blocks
+	BLOCK Integer::shl_blocks(BLOCK* r, const BLOCK* a, size_t n, int shift) {
+		if (shift == 0) {
+			for (size_t i = n; i-- > 0;) { r[i] = a[i]; }
+			return 0;
+		}
+
+		BLOCK out = a[n - 1] >> (BITS - shift);
+		for (size_t i = n - 1; i > 0; --i) {
+			r[i] = (a[i] << shift) | (a[i - 1] >> (BITS - shift));
+		}
+		r[0] = a[0] << shift;
+
+		return out;
+	}
+
+
+	// Shift Right Blocks
+	BLOCK Integer::shr_blocks(BLOCK* r, const BLOCK* a, size_t n, int shift) {
+		if (shift == 0) {
+			for (size_t i = 0; i < n; ++i) { r[i] = a[i]; }
+			return 0;
+		}
+
+		BLOCK out = a[0] << (BITS - shift);
+		for (size_t i = 0; i + 1 < n; ++i) {
+			r[i] = (a[i] >> shift) | (a[i + 1] << (BITS - shift));
+		}
+		r[n - 1] = a[n - 1] >> shift;
+
+		return out;
+	}
+
+
+	// Sum Terms
+	void Integer::sum_terms(Integer& r, const expr::Term* terms, size_t n, bool accumulate) {
+		// Two spare blocks: room for the carries of the terms and for the sign bit
+		size_t len = accumulate ? r.num.size() : 0;
+		bool aliased = false;
+		for (size_t i = 0; i < n; ++i) {
+			len = std::max(len, terms[i].a->num.size() + (terms[i].b ? terms[i].b->num.size() : 0));
+			aliased |= terms[i].a == &r || terms[i].b == &r;
+		}
+		len += 2;
+
+		// Everything is added modulo 2^(32 * len), in r's own blocks unless a term still has to read them
+		BlockVector acc(aliased ? get_block_resource() : r.num.resource());
+		if (!aliased) { acc = std::move(r.num); }
+		else if (accumulate) { acc = r.num; }
+		if (!accumulate) { acc.clear(); }
+		acc.resize(len, 0);
+		if (accumulate && r.sign) { negate_blocks(acc.data(), len); }
+
+		for (size_t i = 0; i < n; ++i) {
+			const Integer& a = *terms[i].a;
+			const Integer* b = terms[i].b;
+			bool negative = terms[i].negative != a.sign;
+
+			if (b) {
+				addmul_blocks(acc.data(), len, a.num.data(), a.num.size(), b->num.data(), b->num.size(), negative != b->sign);
+			}
+			else if (negative) {
+				sub_blocks(acc.data(), acc.data(), len, a.num.data(), a.num.size());
+			}
+			else {
+				add_blocks(acc.data(), acc.data(), len, a.num.data(), a.num.size());
+			}
+		}
+
+		// Back to sign and magnitude
+		bool negative = acc[len - 1] >> (BITS - 1);
+		if (negative) { negate_blocks(acc.data(), len); }
+
+		r.num = std::move(acc);
+		r.sign = negative;
+		r.tweak_blocks();
+	}
+
+
+	// Negate Blocks
+	void Integer::negate_blocks(BLOCK* a, size_t n) {
+		BLOCK_PRODUCT carry = 1;
+		for (size_t i = 0; i < n; ++i) {
+			carry += (BLOCK)~a[i];
+			a[i] = (BLOCK)carry;
+			carry >>= BITS;
+		}
+	}
+
+
+	// Divide Magnitude
+	void Integer::divmod_magnitude(Integer& q, Integer& r, const Integer& a, const Integer& b) {
+		size_t an = a.num.size(), bn = b.num.size();
+
+		// Algorithm D is already cheap when the divisor or the quotient is short
+		if (bn < BURNIKEL_ZIEGLER_THRESHOLD || an < bn + BURNIKEL_ZIEGLER_THRESHOLD) { divmod_knuth(q, r, a, b); }
+		else { divmod_bz(q, r, a, b); }
+
+		q.sign = r.sign = false;
+		q.tweak_blocks();
+		r.tweak_blocks();
+	}
+
+
+	// Divide Knuth
+	void Integer::divmod_knuth(Integer& q, Integer& r, const Integer& a, const Integer& b) {
+		// |a| < |b|, nothing to divide
+		if (compare_blocks(a.num.data(), a.num.size(), b.num.data(), b.num.size()) < 0) {
+			r = a;
+			r.sign = false;
+			q = Integer();
+			return;
+		}
+
+		BlockVector quotient(a.num.size() - b.num.size() + 1), remain(b.num.size());
+		divmod_blocks(quotient.data(), remain.data(), a.num.data(), a.num.size(), b.num.data(), b.num.size());
+
+		q.num.swap(quotient);
+		r.num.swap(remain);
+		q.sign = r.sign = false;
+		q.tweak_blocks();
+		r.tweak_blocks();
+	}
+
+
+	// Divide Burnikel-Ziegler
+	void Integer::divmod_bz(Integer& q, Integer& r, const Integer& a, const Integer& b) {
+		// Normalize so the top bit of b is set, as with Algorithm D
+		int shift = leading_zeros(b.num.back());
+		Integer norm_a = a, norm_b = b;
+		norm_a.num.push_back(shl_blocks(norm_a.num.data(), norm_a.num.data(), norm_a.num.size(), shift));
+		shl_blocks(norm_b.num.data(), norm_b.num.data(), norm_b.num.size(), shift);
+		norm_a.sign = norm_b.sign = false;
+		norm_a.tweak_blocks();
+
+		// Schoolbook long division where every "digit" is n blocks, each step is one div_2n_1n()
+		size_t n = norm_b.num.size();
+		size_t digits = (norm_a.num.size() + n - 1) / n;
+
+		Integer rem, digit_q;
+		q.num.assign(digits * n, 0);
+		for (size_t i = digits; i-- > 0;) {
+			Integer part = shift_blocks(rem, n) + slice_blocks(norm_a, i * n, n);
+			div_2n_1n(digit_q, rem, part, norm_b, n);
+
+			for (size_t j = 0; j < digit_q.num.size(); ++j) { q.num[i * n + j] = digit_q.num[j]; }
+		}
+
+		// Undo the normalization on the remainder
+		shr_blocks(rem.num.data(), rem.num.data(), rem.num.size(), shift);
+
+		r = rem;
+		q.sign = r.sign = false;
+		q.tweak_blocks();
+		r.tweak_blocks();
+	}
+
+
+	// Divide 2n by 1n
+	void Integer::div_2n_1n(Integer& q, Integer& r, const Integer& a, const Integer& b, size_t n) {
+		if (n < BURNIKEL_ZIEGLER_THRESHOLD) {
+			divmod_knuth(q, r, a, b);
+			return;
+		}
+
+		// An odd n can't be halved, pad both operands by a block (keeps b normalized)
+		bool pad = n & 1;
+		Integer pa = pad ? shift_blocks(a, 1) : a, pb = pad ? shift_blocks(b, 1) : b;
+		if (pad) { ++n; }
+
+		size_t half = n / 2;
+		Integer b1 = slice_blocks(pb, half, half), b2 = slice_blocks(pb, 0, half);
+
+		// Two 3 half by 2 half divisions, each produces half of the quotient
+		Integer q1, q2, rem;
+		div_3n_2n(q1, rem, slice_blocks(pa, n, n), slice_blocks(pa, half, half), pb, b1, b2, half);
+		div_3n_2n(q2, rem, rem, slice_blocks(pa, 0, half), pb, b1, b2, half);
+
+		if (pad) { rem = slice_blocks(rem, 1, rem.num.size()); }	// Remainder was scaled by a block too
+
+		q = shift_blocks(q1, half) + q2;
+		r = rem;
+	}
+
+
+	// Divide 3n by 2n
+	void Integer::div_3n_2n(Integer& q, Integer& r, const Integer& a12, const Integer& a3, const Integer& b, const Integer& b1, const Integer& b2, size_t n) {
+		// Estimate q from the top 2n blocks over the top n blocks of b
+		if (slice_blocks(a12, n, n + 1) == b1) {
+			// Quotient would overflow n blocks, use the largest n block value
+			q = shift_blocks(Integer(1), n) - 1;
+			r = a12 - shift_blocks(b1, n) + b1;
+		}
+		else { div_2n_1n(q, r, a12, b1, n); }
+
+		// r = [r, a3] - q * b2, the estimate is at most 2 too large
+		r = shift_blocks(r, n) + a3 - q * b2;
+		while (r.sign) {
+			--q;
+			r += b;
+		}
+	}
+
+
+	// Slice Blocks
+	Integer Integer::slice_blocks(const Integer& x, size_t lo, size_t n) {
+		if (lo >= x.num.size()) { return Integer(); }
+
+		return from_blocks(x.num.data() + lo, std::min(n, x.num.size() - lo));
+	}
+
+
+	// Shift Blocks
+	Integer Integer::shift_blocks(const Integer& x, size_t n) {
+		Integer result = x;
+		if (n > 0 && !(x.num.size() == 1 && x.num[0] == 0)) {
+			result.num.insert(result.num.begin(), n, 0);
+		}
+
+		return result;
+	}
+
+
+	// Bitwise Operation
+	void Integer::bitwise(Integer& r, const Integer& a, const Integer& b, char op) {
+		// Negative operands are read as two's complement (~|x| + 1) on the fly, extended with all ones
+		bool neg = op == '&' ? (a.sign && b.sign) : op == '|' ? (a.sign || b.sign) : (a.sign != b.sign);
+		size_t an = a.num.size(), bn = b.num.size();
+		size_t len = std::max(an, bn) + 1;	// One extra block for the sign
+		bool a_neg = a.sign, b_neg = b.sign;
+
+		BLOCK_PRODUCT carry_a = 1, carry_b = 1, carry_r = 1;
+		if (r.num.size() < len) { r.num.resize(len, 0); }	// r may be a or b, read each block before writing it
+
+		for (size_t i = 0; i < len; ++i) {
+			BLOCK x = i < an ? a.num[i] : 0, y = i < bn ? b.num[i] : 0;
+			if (a_neg) {
+				carry_a += (BLOCK)~x;
+				x = (BLOCK)carry_a;
+				carry_a >>= BITS;
+			}
+			if (b_neg) {
+				carry_b += (BLOCK)~y;
+				y = (BLOCK)carry_b;
+				carry_b >>= BITS;
+			}
+
+			BLOCK z = op == '&' ? (x & y) : op == '|' ? (x | y) : (x ^ y);
+
+			// Back to sign and magnitude
+			if (neg) {
+				carry_r += (BLOCK)~z;
+				z = (BLOCK)carry_r;
+				carry_r >>= BITS;
+			}
+
+			r.num[i] = z;
+		}
+
+		r.num.resize(len);
+		r.sign = neg;
+		r.tweak_blocks();
+	}
+
+
+	// GCD Magnitude
+	void Integer::gcd_magnitude(Integer& a, Integer& b, Cofactors* t) {
+		// Every half-GCD leaves b about half as long
+		while (b.num.size() >= HGCD_THRESHOLD) {
+			if (b.num.size() <= a.num.size() / 2 + 1) {
+				euclid_step(a, b, t);	// Below what the half-GCD reduces to
+				continue;
+			}
+
+			Cofactors m;
+			hgcd(a, b, m);
+			if (t) { compose_cofactors(*t, m); }
+		}
+
+		gcd_lehmer(a, b, t, 0);
+	}
+
+
+	// Half-GCD
+	void Integer::hgcd(Integer& a, Integer& b, Cofactors& t) {
+		size_t n = a.num.size(), s = n / 2 + 1;
+		if (n < HGCD_THRESHOLD) {
+			gcd_lehmer(a, b, &t, s);
+			return;
+		}
+
+		// The top n - n / 2 blocks reduce to about n / 4, which takes the full values to about 3n / 4
+		Integer ah = slice_blocks(a, n / 2, n), bh = slice_blocks(b, n / 2, n);
+		Cofactors m;
+		hgcd(ah, bh, m);
+		apply_cofactors(a, b, m);
+		compose_cofactors(t, m);
+
+		// The top 2(k - s) of the k blocks left reduce by half, which takes the full values to about s
+		size_t k = a.num.size();
+		if (b.num.size() > s) {
+			size_t p = 2 * s > k ? 2 * s - k : 0;
+			Integer ah2 = slice_blocks(a, p, k), bh2 = slice_blocks(b, p, k);
+			Cofactors m2;
+			hgcd(ah2, bh2, m2);
+			apply_cofactors(a, b, m2);
+			compose_cofactors(t, m2);
+		}
+
+		// The quotients the approximations could not see
+		gcd_lehmer(a, b, &t, s);
+	}
+
+
+	// GCD Lehmer
+	void Integer::gcd_lehmer(Integer& a, Integer& b, Cofactors* t, size_t stop) {
+		while (b.num.size() > std::max<size_t>(stop, 2)) {
+			BLOCK u0, u1, v0, v1;
+			bool even;
+			if (!lehmer_simulate(a, b, u0, u1, v0, v1, even)) {
+				euclid_step(a, b, t);	// A quotient too large for the top bits
+				continue;
+			}
+
+			size_t n = a.num.size();
+			b.num.resize(n, 0);
+			lehmer_update(a.num.data(), b.num.data(), n, u0, u1, v0, v1, even);
+			a.tweak_blocks();
+			b.tweak_blocks();
+
+			if (t) {
+				Cofactors m;
+				m.m00 = even ? (long long)u0 : -(long long)u0;
+				m.m01 = even ? -(long long)v0 : (long long)v0;
+				m.m10 = even ? -(long long)u1 : (long long)u1;
+				m.m11 = even ? (long long)v1 : -(long long)v1;
+				compose_cofactors(*t, m);
+			}
+		}
+
+		if (stop > 0 || (b.num.size() == 1 && b.num[0] == 0)) { return; }
+
+		// Both fit 64 bits (after a division if only b did), the rest is Euclid on native words.
+		// The cofactors alternate in sign like those of lehmer_simulate()
+		if (a.num.size() > 2) { euclid_step(a, b, t); }
+
+		BLOCK_PRODUCT x = a.num[0] | (a.num.size() > 1 ? (BLOCK_PRODUCT)a.num[1] << BITS : 0);
+		BLOCK_PRODUCT y = b.num[0] | (b.num.size() > 1 ? (BLOCK_PRODUCT)b.num[1] << BITS : 0);
+		BLOCK_PRODUCT ua = 1, ub = 0, va = 0, vb = 1;
+		bool even = true;
+		while (y != 0) {
+			BLOCK_PRODUCT q = x / y, r = x % y;
+			x = y, y = r;
+
+			BLOCK_PRODUCT u = ua + q * ub, v = va + q * vb;
+			ua = ub, ub = u;
+			va = vb, vb = v;
+			even = !even;
+		}
+
+		a.construct_from_unsigned(x);
+		b.construct_from_unsigned(0);
+
+		if (t) {
+			Cofactors m;
+			m.m00 = ua, m.m01 = va, m.m10 = ub, m.m11 = vb;
+			(even ? m.m01 : m.m00) = -std::move(even ? m.m01 : m.m00);
+			(even ? m.m10 : m.m11) = -std::move(even ? m.m10 : m.m11);
+			compose_cofactors(*t, m);
+		}
+	}
+
+
+	// Lehmer Simulate
+	bool Integer::lehmer_simulate(const Integer& a, const Integer& b, BLOCK& u0, BLOCK& u1, BLOCK& v0, BLOCK& v1, bool& even) {
+		// Bits [lo, lo + 64) of x, lo is where the top 64 bits of a start
+		size_t n = a.num.size();
+		size_t lo = n * BITS - leading_zeros(a.num[n - 1]) - 64;
+		auto window = [lo](const Integer& x) {
+			size_t i = lo / BITS;
+			int bit = lo % BITS;
+			auto block = [&x](size_t j) { return j < x.num.size() ? (BLOCK_PRODUCT)x.num[j] : 0; };
+
+			if (bit == 0) { return block(i) | block(i + 1) << BITS; }
+			return (block(i + 1) | block(i + 2) << BITS) << (BITS - bit) | block(i) >> bit;
+		};
+		BLOCK_PRODUCT a1 = window(a), a2 = window(b);
+
+		// Collins' condition: while it holds, the quotients of (a1, a2) are those of (a, b).
+		// It also bounds the cofactors by sqrt(a1) < 2^32
+		BLOCK_PRODUCT x0 = 0, x1 = 1, x2 = 0;
+		BLOCK_PRODUCT y0 = 0, y1 = 0, y2 = 1;
+		even = false;
+		while (a2 >= y2 && a1 - a2 >= y1 + y2) {
+			BLOCK_PRODUCT q = a1 / a2, r = a1 % a2;
+			a1 = a2, a2 = r;
+
+			BLOCK_PRODUCT x = x1 + q * x2, y = y1 + q * y2;
+			x0 = x1, x1 = x2, x2 = x;
+			y0 = y1, y1 = y2, y2 = y;
+			even = !even;
+		}
+
+		u0 = (BLOCK)x0, u1 = (BLOCK)x1;
+		v0 = (BLOCK)y0, v1 = (BLOCK)y1;
+		return v0 != 0;
+	}
+
+
+	// Lehmer Update
+	void Integer::lehmer_update(BLOCK* a, BLOCK* b, size_t n, BLOCK u0, BLOCK u1, BLOCK v0, BLOCK v1, bool even) {
+		// Each of u0 * a, v0 * b, u1 * a and v1 * b carries on its own, the differences borrow on their own
+		BLOCK_PRODUCT cu0 = 0, cv0 = 0, cu1 = 0, cv1 = 0;
+		BLOCK_PRODUCT borrow_a = 0, borrow_b = 0;
+
+		for (size_t i = 0; i < n; ++i) {
+			cu0 += (BLOCK_PRODUCT)u0 * a[i];
+			cv0 += (BLOCK_PRODUCT)v0 * b[i];
+			cu1 += (BLOCK_PRODUCT)u1 * a[i];
+			cv1 += (BLOCK_PRODUCT)v1 * b[i];
+
+			// Even: a' = u0 * a - v0 * b, b' = v1 * b - u1 * a. Odd: both negated
+			BLOCK_PRODUCT da = even ? (BLOCK_PRODUCT)(BLOCK)cu0 - (BLOCK)cv0 - borrow_a : (BLOCK_PRODUCT)(BLOCK)cv0 - (BLOCK)cu0 - borrow_a;
+			BLOCK_PRODUCT db = even ? (BLOCK_PRODUCT)(BLOCK)cv1 - (BLOCK)cu1 - borrow_b : (BLOCK_PRODUCT)(BLOCK)cu1 - (BLOCK)cv1 - borrow_b;
+			a[i] = (BLOCK)da;
+			b[i] = (BLOCK)db;
+			borrow_a = da >> (2 * BITS - 1);
+			borrow_b = db >> (2 * BITS - 1);
+
+			cu0 >>= BITS, cv0 >>= BITS, cu1 >>= BITS, cv1 >>= BITS;
+		}
+	}
+
+
+	// Euclid Step
+	void Integer::euclid_step(Integer& a, Integer& b, Cofactors* t) {
+		Integer q, r;
+		divmod_magnitude(q, r, a, b);
+		a = std::move(b);
+		b = std::move(r);
+
+		if (t) {
+			Integer m10 = lazy(t->m00) - lazy(q) * t->m10;
+			Integer m11 = lazy(t->m01) - lazy(q) * t->m11;
+			t->m00 = std::move(t->m10), t->m01 = std::move(t->m11);
+			t->m10 = std::move(m10), t->m11 = std::move(m11);
+		}
+	}
+
+
+	// Apply Cofactors
+	void Integer::apply_cofactors(Integer& a, Integer& b, Cofactors& m) {
+		Integer x = lazy(m.m00) * a + lazy(m.m01) * b;
+		Integer y = lazy(m.m10) * a + lazy(m.m11) * b;
+
+		// A last quotient the approximations got wrong can leave a negative value, or the pair out of order
+		if (x.sign) {
+			x.sign = false;
+			m.m00 = -std::move(m.m00), m.m01 = -std::move(m.m01);
+		}
+		if (y.sign) {
+			y.sign = false;
+			m.m10 = -std::move(m.m10), m.m11 = -std::move(m.m11);
+		}
+		if (x < y) {
+			std::swap(x, y);
+			std::swap(m.m00, m.m10), std::swap(m.m01, m.m11);
+		}
+
+		a = std::move(x);
+		b = std::move(y);
+	}
+
+
+	// Compose Cofactors
+	void Integer::compose_cofactors(Cofactors& t, const Cofactors& m) {
+		Integer m00 = lazy(m.m00) * t.m00 + lazy(m.m01) * t.m10;
+		Integer m01 = lazy(m.m00) * t.m01 + lazy(m.m01) * t.m11;
+		Integer m10 = lazy(m.m10) * t.m00 + lazy(m.m11) * t.m10;
+		Integer m11 = lazy(m.m10) * t.m01 + lazy(m.m11) * t.m11;
+
+		t.m00 = std::move(m00), t.m01 = std::move(m01);
+		t.m10 = std::move(m10), t.m11 = std::move(m11);
+	}
+
+
+	// Bit Length
+	size_t Integer::bit_length(const Integer& x) {
+		if (x.num.back() == 0) { return 0; }
+		return x.num.size() * BITS - leading_zeros(x.num.back());
+	}
+
+
+	// Trailing Zeros
+	size_t Integer::trailing_zeros(const Integer& x) {
+		size_t zeros = 0;
+		while (x.num[zeros / BITS] == 0) { zeros += BITS; }
+		while (((x.num[zeros / BITS] >> (zeros % BITS)) & 1) == 0) { ++zeros; }
+
+		return zeros;
+	}
+
+
+	// Square Root Magnitude
+	void Integer::sqrt_magnitude(Integer& r, Integer& rem, const Integer& n) {
+		size_t bits = bit_length(n);
+
+		// Up to 64 bits, a double estimate corrected on native words
+		if (bits <= 64) {
+			BLOCK_PRODUCT v = n.num[0] | (n.num.size() > 1 ? (BLOCK_PRODUCT)n.num[1] << BITS : 0);
+			BLOCK_PRODUCT x = std::min<BLOCK_PRODUCT>((BLOCK_PRODUCT)std::sqrt((double)v), BLOCK(-1));
+			while (x * x > v) { --x; }
+			while (x < BLOCK(-1) && (x + 1) * (x + 1) <= v) { ++x; }
+
+			r.construct_from_unsigned(x);
+			rem.construct_from_unsigned(v - x * x);
+			return;
+		}
+
+		// The root of n / 4^k, rounded up and shifted back, is at most 2^k above sqrt(n).
+		// With 2k <= bits / 2, one Newton step from there leaves r at most one too large
+		size_t k = bits / 4;
+		Integer hi, hi_rem;
+		sqrt_magnitude(hi, hi_rem, n >> (int)(2 * k));
+		++hi;
+		Integer x = std::move(hi) << (int)k;
+		r = (x + n / x) >> 1;
+
+		rem = lazy(n) - lazy(r) * r;
+		while (rem.sign) {
+			--r;
+			rem += (r << 1) + 1;
+		}
+	}
+
+
+	// Root Magnitude
+	Integer Integer::root_magnitude(const Integer& n, size_t k) {
+		size_t bits = bit_length(n);
+		if (bits <= k) { return Integer(n == 0 ? 0 : 1); }	// n < 2^k
+
+		// Up to 32 bits of root, a double estimate from the top 64 bits of n, off by at most one
+		size_t root_bits = (bits - 1) / k + 1;
+		if (root_bits <= 32) {
+			size_t shift = bits > 64 ? bits - 64 : 0;
+			Integer top = n >> (int)shift;
+			double lg = std::log2((double)(top.num[0] | (top.num.size() > 1 ? (BLOCK_PRODUCT)top.num[1] << BITS : 0)));
+			Integer x((unsigned long long)std::exp2((lg + shift) / k));
+
+			Integer e((unsigned long long)k);
+			while (pow(x, e) > n) { --x; }
+			while (pow(x + 1, e) <= n) { ++x; }
+			return x;
+		}
+
+		// The root of n / 2^(k * s), rounded up and shifted back, is above the root with about half its bits right.
+		// Newton's steps from above then decrease to the floor of the root, doubling the bits each time
+		size_t s = root_bits / 2;
+		Integer hi = root_magnitude(n >> (int)(k * s), k);
+		++hi;
+		Integer x = std::move(hi) << (int)s;
+		Integer e((unsigned long long)(k - 1)), d((unsigned long long)k);
+		while (true) {
+			Integer y = (x * (long long)(k - 1) + n / pow(x, e)) / d;
+			if (y >= x) { return x; }
+			x = std::move(y);
+		}
+	}
+
+
+	// Exact Root
+	bool Integer::exact_root(Integer& x, size_t k) {
+		// A k-th power has a multiple of k trailing zero bits
+		if (trailing_zeros(x) % k != 0) { return false; }
+
+		size_t n = x.num.size(), bits = bit_length(x);
+		Integer e((unsigned long long)k);
+		if ((bits - 1) / k + 1 <= 32) {
+			// Short roots: the estimate from the top blocks is off by at most one, and the root's k-th power
+			// has to match x modulo 2^64 before it is worth computing in full
+			double top = 0;
+			for (size_t i = n; i-- > 0 && i + 3 >= n;) { top = top * 4294967296.0 + x.num[i]; }
+			double lg = std::log2(top) + (double)(n > 3 ? n - 3 : 0) * BITS;
+			BLOCK_PRODUCT est = (BLOCK_PRODUCT)std::exp2(lg / k);
+			BLOCK_PRODUCT low = x.num[0] | (n > 1 ? (BLOCK_PRODUCT)x.num[1] << BITS : 0);
+
+			for (BLOCK_PRODUCT c = std::max<BLOCK_PRODUCT>(est, 3) - 1; c <= est + 1; ++c) {
+				BLOCK_PRODUCT power = 1, b = c;
+				for (size_t i = k; i > 0; i >>= 1, b *= b) {
+					if (i & 1) { power *= b; }
+				}
+
+				Integer root((unsigned long long)c);
+				if (power == low && pow(root, e) == x) {
+					x = std::move(root);
+					return true;
+				}
+			}
+			return false;
+		}
+
+		// Long roots: x has to be a k-th power residue modulo a few primes q = 2jk + 1
+		size_t tested = 0;
+		for (BLOCK_PRODUCT q = 2 * k + 1; tested < 3 && q < ((BLOCK_PRODUCT)1 << BITS); q += 2 * k) {
+			bool prime = true;
+			for (BLOCK_PRODUCT d = 3; prime && d * d <= q; d += 2) { prime = q % d != 0; }
+			if (!prime) { continue; }
+
+			BLOCK_PRODUCT r = mod_block(x.num.data(), n, (BLOCK)q), s = 1;
+			for (BLOCK_PRODUCT i = (q - 1) / k; i > 0; i >>= 1, r = r * r % q) {
+				if (i & 1) { s = s * r % q; }
+			}
+			if (s > 1) { return false; }
+			++tested;
+		}
+
+		Integer root, rem;
+		if (k == 2) { sqrt_magnitude(root, rem, x); }
+		else { root = root_magnitude(x, k); }
+
+		if (k == 2 ? rem != 0 : pow(root, e) != x) { return false; }
+		x = std::move(root);
+		return true;
+	}
+
+
+	// Small Primes
+	const std::vector<BLOCK>& Integer::small_primes() {
+		static const std::vector<BLOCK> primes = [] {
+			std::vector<BLOCK> p;
+			std::vector<bool> composite(SIEVE_LIMIT, false);
+			for (size_t i = 2; i < SIEVE_LIMIT; ++i) {
+				if (composite[i]) { continue; }
+
+				p.push_back((BLOCK)i);
+				for (size_t j = i * i; j < SIEVE_LIMIT; j += i) { composite[j] = true; }
+			}
+			return p;
+		}();
+
+		return primes;
+	}
+
+
+	// Prime Residues
+	void Integer::prime_residues(const Integer& n, size_t count, BLOCK* residues) {
+		const std::vector<BLOCK>& primes = small_primes();
+		for (size_t i = 0; i < count;) {
+			BLOCK_PRODUCT product = primes[i];
+			size_t j = i + 1;
+			while (j < count && product * primes[j] <= MAX) { product *= primes[j++]; }
+
+			BLOCK r = mod_block(n.num.data(), n.num.size(), (BLOCK)product);
+			for (; i < j; ++i) { residues[i] = r % primes[i]; }
+		}
+	}
 
-		/**
-		* Get Chunk
-		*
-		* @returns the chunk at a specified index
-		*/
-		unsigned int getChunk(unsigned int n);
 
-	protected:
-	private:
-		std::vector<BLOCK> num;
-		bool sign;
+	// Jacobi Symbol
+	int Integer::jacobi(long long a, const Integer& n) {
+		// (-1 / n) == -1 when n == 3 (mod 4)
+		int result = a < 0 && (n.num[0] & 3) == 3 ? -1 : 1;
+		BLOCK_PRODUCT x = a < 0 ? 0ULL - (unsigned long long)a : (unsigned long long)a;
 
-		/**
-		* Construct From String
-		* Sets big::Integer object data based on passed std::string or const char*
-		*/
-		void construct_from_string(std::string str);
+		// (2 / n) == -1 when n == 3, 5 (mod 8)
+		while (x != 0 && x % 2 == 0) {
+			x /= 2;
+			if ((n.num[0] & 7) == 3 || (n.num[0] & 7) == 5) { result = -result; }
+		}
+		if (x == 0) { return 0; }
 
-		/**
-		* Tweak Blocks
-		*
-		* Fixes any (over/under)flowing Block
-		*/
-		void tweak_blocks();
+		// Reciprocity swaps the long n for its remainder, then it is all native words
+		if ((x & 3) == 3 && (n.num[0] & 3) == 3) { result = -result; }
+		BLOCK_PRODUCT y = mod_block(n.num.data(), n.num.size(), (BLOCK)x);
 
-		/**
-		* Trim Leading (zeros)
-		*
-		* Trims any leading zeros that are taking up unnecessary space
-		*/
-		void trim_leading();
+		while (y != 0) {
+			while (y % 2 == 0) {
+				y /= 2;
+				if (x % 8 == 3 || x % 8 == 5) { result = -result; }
+			}
 
-		/**
-		* Denominator In Remainder
-		*
-		* @param rem Remainder
-		* @param den Denominator
-		*/
-		static BLOCK denominator_in_remainder(const Integer& rem, const Integer& den);
+			std::swap(x, y);
+			if (x % 4 == 3 && y % 4 == 3) { result = -result; }
+			y %= x;
+		}
 
-		/**
-		* Get Binary
-		*
-		* @return bin Binary representation in string form
-		*/
-		std::string get_binary();
+		return x == 1 ? result : 0;
+	}
 
-		/**
-		* From Binary
-		*
-		* @return num Integer representation
-		*/
-		Integer from_binary(const std::string& str);
-	};
 
+	// Miller-Rabin
+	bool Integer::miller_rabin(const ModContext& m, const Integer& a) {
+		// n - 1 = d * 2^s, then a^d, a^(2d), ..., a^(2^(s - 1) d) has to reach -1 (or start at 1)
+		Integer n1 = m.modulus() - 1;
+		size_t s = trailing_zeros(n1);
+		Integer x = m.powmod(a, n1 >> (int)s);
+		if (x == 1 || x == n1) { return true; }
 
-	// Default Constructor
-	Integer::Integer() {
-		num = { 0 };	// Set default value to 0
-		sign = false;
+		for (size_t r = 1; r < s; ++r) {
+			x = m.mulmod(x, x);
+			if (x == n1) { return true; }
+			if (x == 1) { return false; }
+		}
+
+		return false;
 	}
 
 
-	// Integer Constructor
-	Integer::Integer(int n) {
-		// If n == 0, sign is 0
-		// If n  > 0, sign is 0
-		// If n  < 0, sign is 1
-		if (n == 0) { sign = 0; }
-		else if (n > 0) { sign = 0; }
-		else { sign = 1, n = -n; }
+	// Strong Lucas
+	bool Integer::strong_lucas(const ModContext& m) {
+		const Integer& n = m.modulus();
+		if (sqrtrem(n).rem == 0) { return false; }	// No D below would ever be found
 
-		do {
-			num.push_back(n % BASE);
-			n /= BASE;
-		} while (n > 0);
+		// Selfridge's parameters: the first D of 5, -7, 9, -11, ... with (D / n) == -1, P = 1 and Q = (1 - D) / 4
+		long long d = 5;
+		for (int j; (j = jacobi(d, n)) != -1; d = d > 0 ? -d - 2 : -d + 2) {
+			if (j == 0) { return false; }	// n > |D| shares a factor with D
+		}
+
+		// n + 1 = k * 2^s. U_k, V_k and Q^k from the bits of k, doubling with U_2j = U_j V_j, V_2j = V_j^2 - 2Q^j
+		// and stepping with U_j+1 = (U_j + V_j) / 2, V_j+1 = (D U_j + V_j) / 2. Every step is linear apart from
+		// the products, so it all runs in Montgomery form (n is odd)
+		Integer k = n + 1;
+		size_t s = trailing_zeros(k);
+		k >>= (int)s;
+
+		auto half = [&n](Integer& x) {
+			if (x.num[0] & 1) { x += n; }
+			x >>= 1;
+			if (x >= n) { x -= n; }
+		};
+		auto double_v = [&](Integer& v, const Integer& qj) {
+			v = m.montgomery_product(v, v) - (qj << 1);
+			while (v.sign) { v += n; }
+		};
+
+		Integer dm = m.to_montgomery(Integer(d)), q = m.to_montgomery(Integer((1 - d) / 4));
+		Integer u = m.to_montgomery(Integer(1)), v = u, qk = q;
+		for (size_t i = bit_length(k) - 1; i-- > 0;) {
+			u = m.montgomery_product(u, v);
+			double_v(v, qk);
+			qk = m.montgomery_product(qk, qk);
+
+			if ((k.num[i / BITS] >> (i % BITS)) & 1) {
+				Integer u1 = u + v, v1 = m.montgomery_product(dm, u) + v;
+				if (u1 >= n) { u1 -= n; }
+				if (v1 >= n) { v1 -= n; }
+				half(u1);
+				half(v1);
+				u = std::move(u1), v = std::move(v1);
+				qk = m.montgomery_product(qk, q);
+			}
+		}
+
+		// Strong: U_k == 0, or V_(k * 2^r) == 0 for some r < s
+		if (u == 0 || v == 0) { return true; }
+		for (size_t r = 1; r < s; ++r) {
+			double_v(v, qk);
+			if (v == 0) { return true; }
+			qk = m.montgomery_product(qk, qk);
+		}
+
+		return false;
 	}
 
 
-	// Long Constructor
-	Integer::Integer(long n) {
-		if (n == 0) { sign = 0; }
-		else if (n > 0) { sign = 0; }
-		else { sign = 1, n = -n; }
+	// Probable Prime (Sieved)
+	bool Integer::probable_prime(const Integer& n, size_t rounds) {
+		ModContext m(n);
+		if (!miller_rabin(m, Integer(2)) || !strong_lucas(m)) { return false; }
 
-		do {
-			num.push_back(n % BASE);
-			n /= BASE;
-		} while (n > 0);
+		// Extra rounds to random bases in [2, n - 2]
+		Integer n1 = n - 1;
+		for (size_t i = 0; i < rounds; ++i) {
+			if (!miller_rabin(m, random(Integer(2), n1))) { return false; }
+		}
+
+		return true;
 	}
 
 
-	// LLong Constructor
-	Integer::Integer(long long n) {
-		if (n == 0) { sign = 0; }
-		else if (n > 0) { sign = 0; }
-		else { sign = 1, n = -n; }
+	// Fill Random
+	template <class Engine>
+	void Integer::fill_random(BLOCK* p, size_t n, Engine& engine) {
+		using result = typename Engine::result_type;
+		if constexpr (Engine::min() == 0 && Engine::max() == ~(result)0 && sizeof(result) >= 2 * sizeof(BLOCK)) {
+			size_t i = 0;
+			for (; i + 1 < n; i += 2) {
+				BLOCK_PRODUCT x = (BLOCK_PRODUCT)engine();
+				p[i] = (BLOCK)x;
+				p[i + 1] = (BLOCK)(x >> BITS);
+			}
+			if (i < n) { p[i] = (BLOCK)engine(); }
+		}
+		else if constexpr (Engine::min() == 0 && Engine::max() == MAX) {
+			for (size_t i = 0; i < n; ++i) { p[i] = (BLOCK)engine(); }
+		}
+		else {
+			std::uniform_int_distribution<BLOCK> dist(MIN, MAX);	// Any other range
+			for (size_t i = 0; i < n; ++i) { p[i] = dist(engine); }
+		}
+	}
 
-		do {
-			num.push_back(n % BASE);
-			n /= BASE;
-		} while (n > 0);
+
+	// Fill Bits
+	template <class Engine>
+	void Integer::fill_bits(Integer& r, size_t bits, Engine& engine) {
+		size_t n = std::max<size_t>((bits + BITS - 1) / BITS, 1);
+		r.num.resize(n);
+		fill_random(r.num.data(), n, engine);
+
+		if (bits % BITS != 0) { r.num[n - 1] &= ((BLOCK)1 << (bits % BITS)) - 1; }
+		if (bits == 0) { r.num[0] = 0; }
+		r.sign = false;
+		r.tweak_blocks();
 	}
 
 
-	// uInt Constructor
-	Integer::Integer(unsigned int n) {
-		sign = 0;
-		do {
-			num.push_back(n % BASE);
-			n /= BASE;
-		} while (n > 0);
+	// Reduce
+	template <class Iterator, class Op>
+	void Integer::reduce(Integer& out, Iterator first, size_t n, size_t leaf, const Op& op, ThreadPool* pool) {
+		if (n <= leaf) {
+			out = *first;
+			for (size_t i = 1; i < n; ++i) { op(out, *++first); }
+			return;
+		}
+
+		// Equal counts keep the two halves of a product the same size
+		size_t half = n / 2;
+		Iterator middle = std::next(first, half);
+
+		if (pool && n >= REDUCE_GRAIN) {
+			// Filled on whichever thread runs the task, so from the resource every thread shares
+			Integer left(std::pmr::get_default_resource()), right(std::pmr::get_default_resource());
+			pool->fork(2, [&](size_t i) {
+				if (i == 0) { reduce(left, first, half, leaf, op, pool); }
+				else { reduce(right, middle, n - half, leaf, op, pool); }
+			});
+
+			out = std::move(left);
+			op(out, right);
+			return;
+		}
+
+		Integer right;
+		reduce(out, first, half, leaf, op, pool);
+		reduce(right, middle, n - half, leaf, op, pool);
+		op(out, right);
 	}
 
 
-	// uLong Constructor
-	Integer::Integer(unsigned long n) {
-		sign = 0;
-		do {
-			num.push_back(n % BASE);
-			n /= BASE;
-		} while (n > 0);
+	// Reduction Pool
+	ThreadPool* Integer::reduction_pool(std::unique_ptr<ThreadPool>& local) {
+		if (ThreadPool* pool = multiply_pool()) { return pool; }
+
+		unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+		if (threads > 1) { local = std::make_unique<ThreadPool>(threads); }
+		return local.get();
 	}
 
 
-	// uLLong Constructor
-	Integer::Integer(unsigned long long n) {
-		sign = 0;
-		do {
-			num.push_back(n % BASE);
-			n /= BASE;
-		} while (n > 0);
+	/////////////////
+	// IntegerView //
+	/////////////////
+
+	// Integer Constructor
+	IntegerView::IntegerView(const Integer& x) : _data(x.num.data()), _size(x.num.size()), _sign(x.sign) { }
+
+
+	// Blocks Constructor
+	IntegerView::IntegerView(const BLOCK* blocks, size_t n, bool negative) : _data(blocks), _size(n), _sign(negative) {
+		static const BLOCK zero = 0;
+
+		while (_size > 1 && _data[_size - 1] == 0) { --_size; }
+		if (_size == 0) { _data = &zero, _size = 1; }
+		if (_size == 1 && _data[0] == 0) { _sign = false; }	// Zero is never negative
 	}
 
 
-	// Char Array Constructor
-	Integer::Integer(const char* str) {
-		construct_from_string(str);
+	// Get Data
+	const BLOCK* IntegerView::data() const {
+		return _data;
 	}
 
 
-	// std::string Constructor
-	Integer::Integer(const std::string& str) {
-		construct_from_string(str);
+	// Get Size
+	size_t IntegerView::size() const {
+		return _size;
 	}
 
-	// Deconstructor
-	Integer::~Integer() {
-		num.clear();
+
+	// Get Sign
+	bool IntegerView::negative() const {
+		return _sign;
 	}
 
 
-	// Copy Constructor
-	Integer::Integer(const Integer& o) {
-		num.clear();
+	// Compare
+	int IntegerView::compare(IntegerView o) const {
+		if (_sign != o._sign) { return _sign ? -1 : 1; }
 
-		sign = o.sign;
-		for (BLOCK i : o.num) {
-			num.push_back(i);
-		}
+		int magnitude = Integer::compare_blocks(_data, _size, o._data, o._size);
+		return _sign ? -magnitude : magnitude;
 	}
 
 
-	// Integer Object Assignment
-	Integer& Integer::operator=(const Integer& o) {
-		num.clear();
+	// View Addition
+	Integer operator+(IntegerView a, IntegerView b) {
+		return Integer::add_views(a, b, false);
+	}
 
-		sign = o.sign;
-		for (BLOCK i : o.num) {
-			num.push_back(i);
-		}
 
-		return *this;
+	// View Subtraction
+	Integer operator-(IntegerView a, IntegerView b) {
+		return Integer::add_views(a, b, true);
 	}
 
 
-	// Int Assignment
-	Integer& Integer::operator=(int n) {
-		num.clear();
+	// View Multiplication
+	Integer operator*(IntegerView a, IntegerView b) {
+		Integer result;
+		result.num.resize(a.size() + b.size());
 
-		if (n == 0) { sign = 0; }
-		else if (n > 0) { sign = 0; }
-		else { sign = 1, n = -n; }
+		// The views may overlap, mul_blocks() only reads them and squares only when both are the same blocks
+		Integer::mul_blocks(result.num.data(), a.data(), a.size(), b.data(), b.size());
 
-		while (n > 0) {
-			num.push_back(n % BASE);
-			n /= BASE;
-		}
+		result.sign = a.negative() != b.negative();
+		result.tweak_blocks();
 
-		return *this;
+		return result;
 	}
 
 
-	// Long Assignment
-	Integer& Integer::operator=(long n) {
-		num.clear();
+	// View Comparison
+	bool operator==(IntegerView a, IntegerView b) { return a.compare(b) == 0; }
+	bool operator!=(IntegerView a, IntegerView b) { return a.compare(b) != 0; }
+	bool operator<(IntegerView a, IntegerView b) { return a.compare(b) < 0; }
+	bool operator>(IntegerView a, IntegerView b) { return a.compare(b) > 0; }
+	bool operator<=(IntegerView a, IntegerView b) { return a.compare(b) <= 0; }
+	bool operator>=(IntegerView a, IntegerView b) { return a.compare(b) >= 0; }
+
+
+	// Add Views
+	Integer Integer::add_views(IntegerView a, IntegerView b, bool subtract) {
+		bool b_sign = b.negative() != subtract;
+		Integer result;
 
-		if (n == 0) { sign = 0; }
-		else if (n > 0) { sign = 0; }
-		else { sign = 1, n = -n; }
+		if (a.negative() == b_sign) {
+			// Same sign, magnitudes add
+			if (a.size() < b.size()) { std::swap(a, b); }
 
-		while (n > 0) {
-			num.push_back(n % BASE);
-			n /= BASE;
+			result.num.resize(a.size() + 1);
+			result.num[a.size()] = add_blocks(result.num.data(), a.data(), a.size(), b.data(), b.size());
+			result.sign = b_sign;
+		}
+		else if (compare_blocks(a.data(), a.size(), b.data(), b.size()) >= 0) {
+			// Opposite signs, |a| >= |b| keeps the sign of a
+			result.num.resize(a.size());
+			sub_blocks(result.num.data(), a.data(), a.size(), b.data(), b.size());
+			result.sign = a.negative();
+		}
+		else {
+			// Opposite signs, |b| > |a| takes the sign of b
+			result.num.resize(b.size());
+			sub_blocks(result.num.data(), b.data(), b.size(), a.data(), a.size());
+			result.sign = b_sign;
 		}
 
-		return *this;
+		result.tweak_blocks();
+		return result;
 	}
 
 
-	// LLong Assignment
-	Integer& Integer::operator=(long long n) {
-		num.clear();
+	// Read Serial Header
+	size_t Integer::read_serial_header(const unsigned char* buffer, size_t size) {
+		if (size < SERIAL_HEADER) {
+			throw IntegerException("Serialized Integer is truncated");
+		}
+		if (buffer[0] != SERIAL_VERSION) {
+			throw IntegerException("Unsupported serialized Integer version");
+		}
 
-		if (n == 0) { sign = 0; }
-		else if (n > 0) { sign = 0; }
-		else { sign = 1, n = -n; }
+		uint64_t n = 0;
+		for (int i = 0; i < 8; ++i) { n |= (uint64_t)buffer[4 + i] << (8 * i); }
 
-		while (n > 0) {
-			num.push_back(n % BASE);
-			n /= BASE;
+		if (buffer[1] > 1 || buffer[2] != 0 || buffer[3] != 0 || n == 0) {
+			throw IntegerException("Invalid serialized Integer header");
+		}
+		if ((size - SERIAL_HEADER) / sizeof(BLOCK) < n) {
+			throw IntegerException("Serialized Integer is truncated");
 		}
 
-		return *this;
+		return (size_t)n;
 	}
 
 
-	// uInt Assignment
-	Integer& Integer::operator=(unsigned int n) {
-		num.clear();
+	// Little Endian Host
+	bool Integer::little_endian_host() {
+		const BLOCK one = 1;
+		return *reinterpret_cast<const unsigned char*>(&one) == 1;
+	}
 
-		sign = 0;
 
-		while (n > 0) {
-			num.push_back(n % BASE);
-			n /= BASE;
-		}
+	///////////////////
+	// Serialization //
+	///////////////////
 
-		return *this;
+	// Serialized Size
+	size_t serialized_size(const Integer& x) {
+		return SERIAL_HEADER + IntegerView(x).size() * sizeof(BLOCK);
 	}
 
 
-	// uLong Assignment
-	Integer& Integer::operator=(unsigned long n) {
-		num.clear();
+	// Serialize
+	size_t serialize(const Integer& x, void* buffer, size_t size) {
+		size_t n = x.num.size(), total = serialized_size(x);
+		if (size < total) {
+			throw IntegerException("Buffer is too small for the serialized Integer");
+		}
 
-		sign = 0;
+		unsigned char* p = static_cast<unsigned char*>(buffer);
+		p[0] = SERIAL_VERSION;
+		p[1] = x.sign ? 1 : 0;
+		p[2] = p[3] = 0;
+		for (int i = 0; i < 8; ++i) { p[4 + i] = (unsigned char)((uint64_t)n >> (8 * i)); }
 
-		while (n > 0) {
-			num.push_back(n % BASE);
-			n /= BASE;
+		// Blocks are written little-endian whatever the host, which is a plain copy on most
+		p += SERIAL_HEADER;
+		if (Integer::little_endian_host()) { std::memcpy(p, x.num.data(), n * sizeof(BLOCK)); }
+		else {
+			for (size_t i = 0; i < n; ++i) {
+				for (size_t j = 0; j < sizeof(BLOCK); ++j) { *p++ = (unsigned char)(x.num[i] >> (8 * j)); }
+			}
 		}
 
-		return *this;
+		return total;
 	}
 
 
-	// uLLong Assignment
-	Integer& Integer::operator=(unsigned long long n) {
-		num.clear();
+	// Deserialize
+	size_t deserialize(Integer& x, const void* buffer, size_t size) {
+		const unsigned char* p = static_cast<const unsigned char*>(buffer);
+		size_t n = Integer::read_serial_header(p, size);
 
-		sign = 0;
+		x.sign = p[1] != 0;
+		x.num.resize(n);
 
-		while (n > 0) {
-			num.push_back(n % BASE);
-			n /= BASE;
+		p += SERIAL_HEADER;
+		if (Integer::little_endian_host()) { std::memcpy(x.num.data(), p, n * sizeof(BLOCK)); }
+		else {
+			for (size_t i = 0; i < n; ++i, p += sizeof(BLOCK)) {
+				BLOCK block = 0;
+				for (size_t j = 0; j < sizeof(BLOCK); ++j) { block |= (BLOCK)p[j] << (8 * j); }
+				x.num[i] = block;
+			}
 		}
 
-		return *this;
+		x.tweak_blocks();
+		return SERIAL_HEADER + n * sizeof(BLOCK);
 	}
 
 
-	// Char Array Assignment
-	Integer& Integer::operator=(const char* c) {
-		num.clear();
+	// View
+	IntegerView view(const void* buffer, size_t size) {
+		const unsigned char* p = static_cast<const unsigned char*>(buffer);
+		size_t n = Integer::read_serial_header(p, size);
 
-		construct_from_string(c);
+		// The blocks are used where they are, so they must already be BLOCKs
+		if (!Integer::little_endian_host() || reinterpret_cast<uintptr_t>(p + SERIAL_HEADER) % alignof(BLOCK) != 0) {
+			throw IntegerException("Serialized Integer cannot be viewed in place, deserialize it instead");
+		}
 
-		return *this;
+		return IntegerView(reinterpret_cast<const BLOCK*>(p + SERIAL_HEADER), n, p[1] != 0);
 	}
 
 
-	// std::string Constructor
-	Integer& Integer::operator=(const std::string& c) {
-		num.clear();
+	// Import Words
+	void import_words(Integer& x, const void* data, size_t count, size_t size, Endian order, Endian endian) {
+		Endian host = Integer::little_endian_host() ? Endian::LITTLE : Endian::BIG;
+		if (order == Endian::NATIVE) { order = host; }
+		if (endian == Endian::NATIVE) { endian = host; }
 
-		construct_from_string(c);
+		const unsigned char* p = static_cast<const unsigned char*>(data);
+		x.num.assign(count * size / sizeof(BLOCK) + 1, 0);
 
-		return *this;
+		// Byte k of the magnitude (least significant first) is byte j of word w
+		for (size_t w = 0; w < count; ++w) {
+			const unsigned char* word = p + (order == Endian::BIG ? count - 1 - w : w) * size;
+			for (size_t j = 0; j < size; ++j) {
+				size_t k = w * size + j;
+				BLOCK byte = word[endian == Endian::BIG ? size - 1 - j : j];
+				x.num[k / sizeof(BLOCK)] |= byte << (8 * (k % sizeof(BLOCK)));
+			}
+		}
+
+		x.sign = false;
+		x.tweak_blocks();
 	}
 
 
-	// Ostream Operator Overload
-	std::ostream& operator<<(std::ostream& os, const Integer& o) {
-		if (o.sign) { os << '-'; }	// Append negative sign
-
-		bool first = true;
-		for (int i = o.num.size() - 1; i > -1; --i) {
-			// [1][000000001] == { 1, 1 }
-			// Need to append leading zeros if this isn't the first block
-			if (first) {
-				os << o.num[i];
-				first = false;
-			}
-			else {
-				os << std::setfill('0') << std::setw(DIGITS) << o.num[i];
+	// Export Words
+	size_t export_words(void* data, size_t size, Endian order, Endian endian, const Integer& x) {
+		Endian host = Integer::little_endian_host() ? Endian::LITTLE : Endian::BIG;
+		if (order == Endian::NATIVE) { order = host; }
+		if (endian == Endian::NATIVE) { endian = host; }
+
+		unsigned char* p = static_cast<unsigned char*>(data);
+		size_t count = export_count(x, size);
+
+		for (size_t w = 0; w < count; ++w) {
+			unsigned char* word = p + (order == Endian::BIG ? count - 1 - w : w) * size;
+			for (size_t j = 0; j < size; ++j) {
+				size_t k = w * size + j, block = k / sizeof(BLOCK);
+				BLOCK byte = block < x.num.size() ? (x.num[block] >> (8 * (k % sizeof(BLOCK)))) & 0xFF : 0;
+				word[endian == Endian::BIG ? size - 1 - j : j] = (unsigned char)byte;
 			}
 		}
 
-		return os;
+		return count;
 	}
 
 
-	// to_string()
-	std::string to_string(const Integer& n) {
-		std::ostringstream ss;
-		ss << n;
-		return ss.str();
-	}
+	// Export Count
+	size_t export_count(const Integer& x, size_t size) {
+		if (x.num.size() == 1 && x.num[0] == 0) { return 0; }
 
+		size_t bits = x.num.size() * BITS - Integer::leading_zeros(x.num.back());
+		return (bits + 8 * size - 1) / (8 * size);
+	}
 
-	// Equivalence Operator Overload
-	bool Integer::operator==(const Integer& o) const {
-		if (sign != o.sign) { return false; }
-		if (num.size() != o.num.size()) { return false; }
 
-		for (int i = 0; i < num.size(); ++i) {
-			if (num[i] != o.num[i]) { return false; }
-		}
+	///////////////////
+	// DecimalReader //
+	///////////////////
 
-		return true;
+	// Default Constructor
+	DecimalReader::DecimalReader() : _started(false), _negative(false), _done(false) {
+		_pending.reserve(STREAM_CHUNK);
 	}
 
 
-	// Not-Equivalence Operator Overload
-	bool Integer::operator!=(const Integer& o) const {
-		if (sign != o.sign) { return true; }
-		if (num.size() != o.num.size()) { return true; }
+	// Feed
+	const char* DecimalReader::feed(const char* first, const char* last) {
+		const char* p = first;
+		if (_done) { return p; }
 
-		for (int i = 0; i < num.size(); ++i) {
-			if (num[i] != o.num[i]) { return true; }
+		if (!_started && p != last) {
+			_started = true;
+			if (*p == '-') {
+				_negative = true;
+				++p;
+			}
 		}
 
-		return false;
-	}
+		while (p != last) {
+			// Digits up to the end of the input, a non-digit or a full chunk
+			const char* run = p;
+			size_t room = STREAM_CHUNK - _pending.size();
+			while (p != last && (size_t)(p - run) < room && (unsigned char)(*p - '0') < 10) { ++p; }
+			_pending.append(run, p);
+
+			if (_pending.size() == STREAM_CHUNK) { push_piece(); }
+			else if (p != last) {
+				_done = true;
+				break;
+			}
+		}
 
+		return p;
+	}
 
-	// Less-Than Operator Overload
-	bool Integer::operator<(const Integer& o) const {
-		if (sign && !o.sign) { return true; }		// Negative vs Positive
-		else if (!sign && o.sign) { return false; }	// Positive vs Negative
 
-		if (num.size() < o.num.size()) { return sign ? false : true; }	// +Short < +Long
-		if (num.size() > o.num.size()) { return sign ? true : false; }	// -Long < -Short
+	// Started
+	bool DecimalReader::started() const {
+		return _started;
+	}
 
-		for (int i = num.size() - 1; i > -1; --i) {
-			if (num[i] < o.num[i]) { return sign ? false : true; }
-			if (num[i] > o.num[i]) { return sign ? true : false; }
-		}
 
-		return false;	// ==
+	// Done
+	bool DecimalReader::done() const {
+		return _done;
 	}
 
 
-	// Greater-Than Operator Overload
-	bool Integer::operator>(const Integer& o) const {
-		if (sign && !o.sign) { return false; }		// Negative vs Positive
-		else if (!sign && o.sign) { return true; }	// Positive vs Negative
+	// Finish
+	bool DecimalReader::finish(Integer& value) {
+		bool digits = !_pieces.empty() || !_pending.empty();
+
+		if (digits) {
+			// Pieces shrink towards the end, so each join multiplies by the next piece's power of ten
+			Integer r;
+			for (size_t i = 0; i < _pieces.size(); ++i) {
+				if (i > 0) { r *= Integer::decimal_power(STREAM_CHUNK_LEVEL + _levels[i]); }
+				r += _pieces[i];
+			}
 
-		if (num.size() < o.num.size()) { return sign ? true : false; }	// +Short !> +Long
-		if (num.size() > o.num.size()) { return sign ? false : true; }	// -Long !> -Short
+			if (!_pending.empty()) {
+				Integer tail;
+				Integer::parse_decimal(tail, _pending.data(), _pending.size());
+				if (!_pieces.empty()) { r *= pow(Integer(10), Integer(_pending.size())); }
+				r += tail;
+			}
 
-		for (int i = num.size() - 1; i > -1; --i) {
-			if (num[i] < o.num[i]) { return sign ? true : false; }
-			if (num[i] > o.num[i]) { return sign ? false : true; }
+			r.sign = _negative;
+			r.tweak_blocks();
+			value = std::move(r);
 		}
 
-		return false;	// ==
+		_pending.clear();
+		_pieces.clear();
+		_levels.clear();
+		_started = _negative = _done = false;
+		return digits;
 	}
 
 
-	// Less-Than or Equal-To Operator Overload
-	bool Integer::operator<=(const Integer& o) const {
-		if (sign && !o.sign) { return true; }		// Negative vs Positive
-		else if (!sign && o.sign) { return false; }	// Positive vs Negative
+	// Push Piece
+	void DecimalReader::push_piece() {
+		Integer piece;
+		Integer::parse_decimal(piece, _pending.data(), _pending.size());
+		_pending.clear();
 
-		if (num.size() < o.num.size()) { return sign ? false : true; }	// +Short < +Long
-		if (num.size() > o.num.size()) { return sign ? true : false; }	// -Long < -Short
+		// Two pieces of 9 * 2^k digits make one of 9 * 2^(k + 1)
+		size_t level = 0;
+		while (!_levels.empty() && _levels.back() == level) {
+			_pieces.back() *= Integer::decimal_power(STREAM_CHUNK_LEVEL + level);
+			_pieces.back() += piece;
+			piece = std::move(_pieces.back());
 
-		for (int i = num.size() - 1; i > -1; --i) {
-			if (num[i] < o.num[i]) { return sign ? false : true; }
-			if (num[i] > o.num[i]) { return sign ? true : false; }
+			_pieces.pop_back();
+			_levels.pop_back();
+			++level;
 		}
 
-		return true;	// ==
+		_pieces.push_back(std::move(piece));
+		_levels.push_back(level);
 	}
 
 
-	// Greater-Than or Equal-To Operator Overload
-	bool Integer::operator>=(const Integer& o) const {
-		if (sign && !o.sign) { return false; }		// Negative vs Positive
-		else if (!sign && o.sign) { return true; }	// Positive vs Negative
-
-		if (num.size() < o.num.size()) { return sign ? true : false; }	// +Short !> +Long
-		if (num.size() > o.num.size()) { return sign ? false : true; }	// -Long !> -Short
+	////////////////
+	// ModContext //
+	////////////////
 
-		for (int i = num.size() - 1; i > -1; --i) {
-			if (num[i] < o.num[i]) { return sign ? true : false; }
-			if (num[i] > o.num[i]) { return sign ? false : true; }
+	// Constructor (primary)
+	ModContext::ModContext(const Integer& modulus) : _modulus(modulus), _n(modulus.num.size()), _m_inv(0) {
+		if (modulus.sign || modulus == 0) {
+			throw IntegerException("Modulus must be positive");
 		}
 
-		return true;	// ==
+		Integer power = 1;
+		power <<= (int)(2 * _n * BITS);		// 2^(64n)
+		_mu = power / _modulus;
+
+		if (montgomery()) {
+			_r2 = power % _modulus;		// R^2 == 2^(64n)
+
+			// Newton's iteration for m0^-1 (mod 2^32), each step doubles the correct low bits
+			BLOCK m0 = _modulus.num[0], inv = m0;	// Correct to 3 bits for odd m0
+			for (int i = 0; i < 4; ++i) { inv *= 2 - m0 * inv; }
+			_m_inv = 0 - inv;
+		}
 	}
 
 
-	// Addition Overload
-	Integer Integer::operator+(const Integer& o) const {
-		Integer result;
+	// Get Modulus
+	const Integer& ModContext::modulus() const {
+		return _modulus;
+	}
 
-		size_t len = (num.size() > o.num.size() ? num.size() : o.num.size());
-		result.num.resize(len, 0);
 
-		for (int i = 0; i < len; ++i) {
-			result.num[i] = (i < num.size() ? (sign ? -num[i] : num[i]) : 0) + (i < o.num.size() ? (o.sign ? -o.num[i] : o.num[i]) : 0);
-		}
+	// Reduce
+	Integer ModContext::reduce(const Integer& x) const {
+		if (!x.sign && x.num.size() <= 2 * _n) { return barrett(x); }
 
-		result.tweak_blocks();
+		Integer r = divmod(x, _modulus, Rounding::EUCLIDEAN).rem;	// Out of Barrett's range
+		return r;
+	}
 
-		return result;
+
+	// Modular Multiplication
+	Integer ModContext::mulmod(const Integer& a, const Integer& b) const {
+		// Reduced factors keep the product under 2^(64n)
+		return barrett(reduce(a) * reduce(b));
 	}
 
 
-	// Subtraction Overload
-	Integer Integer::operator-(const Integer& o) const {
-		Integer result;
+	// Modular Exponentiation
+	Integer ModContext::powmod(const Integer& base, const Integer& exp) const {
+		if (exp.sign) {
+			return powmod(invmod(base, _modulus), -exp);
+		}
+
+		bool mont = montgomery();
+		auto mul = [&](const Integer& a, const Integer& b) { return mont ? montgomery_product(a, b) : barrett(a * b); };
 
-		size_t len = (num.size() > o.num.size() ? num.size() : o.num.size());
-		result.num.resize(len, 0);
+		// Window size from the exponent's length
+		size_t bits = exp.num.size() * BITS - Integer::leading_zeros(exp.num.back());
+		int k = bits <= 8 ? 1 : bits <= 64 ? 3 : bits <= 256 ? 4 : bits <= 1024 ? 5 : 6;
 
-		for (int i = 0; i < len; ++i) {
-			result.num[i] = (i < num.size() ? (sign ? -num[i] : num[i]) : 0) - (i < o.num.size() ? (o.sign ? -o.num[i] : o.num[i]) : 0);
+		// Odd powers base^1, base^3, ..., base^(2^k - 1)
+		Integer x = mont ? to_montgomery(base) : reduce(base);
+		std::vector<Integer> odd(1, x);
+		if (k > 1) {
+			Integer x2 = mul(x, x);
+			for (int i = 1; i < (1 << (k - 1)); ++i) { odd.push_back(mul(odd.back(), x2)); }
 		}
 
-		result.tweak_blocks();
+		Integer result = mont ? to_montgomery(1) : reduce(1);
+		auto bit = [&](size_t i) { return (exp.num[i / BITS] >> (i % BITS)) & 1; };
 
-		return result;
-	}
+		// Left to right, a zero bit is one squaring, otherwise the longest window (up to k bits) ending in a one
+		for (size_t i = bits; i > 0;) {
+			if (!bit(i - 1)) {
+				result = mul(result, result);
+				--i;
+				continue;
+			}
 
+			size_t low = i > (size_t)k ? i - k : 0;
+			while (!bit(low)) { ++low; }
 
-	// Multiplication Overload (Object)
-	Integer Integer::operator*(const Integer& o) const {
-		Integer result;
-		result.num.resize(num.size() + o.num.size(), 0);
-		BLOCK_PRODUCT carry = 0;
-		int digi = 0;
+			BLOCK window = 0;
+			for (size_t j = i; j > low; --j) {
+				result = mul(result, result);
+				window = window << 1 | bit(j - 1);
+			}
+			result = mul(result, odd[window >> 1]);
+			i = low;
+		}
+
+		return mont ? from_montgomery(result) : result;
+	}
 
-		for (;; ++digi) {
-			// Set signifigance of the carry
-			result.num[digi] = carry % BASE;
-			carry /= BASE;
 
+	// Has Montgomery Form
+	bool ModContext::montgomery() const {
+		return _modulus.num[0] & 1;
+	}
 
-			// Continually loop across the blocks
-			bool found = false;
-			for (int i = digi < o.num.size() ? 0 : digi - o.num.size() + 1; i < num.size() && i <= digi; ++i) {
-				// Find block product
-				BLOCK_PRODUCT prod = result.num[digi] + num[i] * (BLOCK_PRODUCT)o.num[digi - i];
 
-				// Correct overflows
-				if (prod > MAX || prod < -MAX) {
-					carry += prod / BASE;
-					prod %= BASE;
-				}
+	// To Montgomery Form
+	Integer ModContext::to_montgomery(const Integer& x) const {
+		require_montgomery();
 
-				// Modify vector
-				result.num[digi] = prod;
-				found = true;
-			}
+		return montgomery_product(reduce(x), _r2);
+	}
 
-			// Result found, do no more math
-			if (!found) { break; }
-		}
 
-		// Handle any remaining carry blocks
-		for (; carry > 0; ++digi) {
-			result.num[digi] = carry % BASE;
-			carry /= BASE;
-		}
+	// From Montgomery Form
+	Integer ModContext::from_montgomery(const Integer& x) const {
+		require_montgomery();
 
-		result.tweak_blocks();
+		// t holds 2n + 1 blocks, a wider or negative x is brought into range first
+		if (!reduced(x)) { return from_montgomery(reduce(x)); }
 
-		// Calculated sign
-		result.sign = (result.num.size() == 1 && result.num[0] == 0) ? false : (sign != o.sign);
+		BlockVector t(2 * _n + 1);
+		std::copy(x.num.begin(), x.num.end(), t.begin());
 
-		return result;
+		Integer r;
+		redc(t, r);
+		return r;
 	}
 
 
-	// Multiplication Overload (Block)
-	Integer Integer::operator*(BLOCK n) {
-		Integer result;
+	// Montgomery Multiplication
+	Integer ModContext::montgomery_mul(const Integer& a, const Integer& b) const {
+		require_montgomery();
+
+		// The product buffer holds 2n + 1 blocks, so wider or negative operands are brought into range first
+		if (!reduced(a) || !reduced(b)) { return montgomery_product(reduce(a), reduce(b)); }
+		return montgomery_product(a, b);
+	}
 
-		BLOCK factor = abs(n);	// Factor to be multiplied (scale)
-		BLOCK carry = 0;		// Carry block
 
-		size_t len = num.size();
-		result.num.resize(len, 0);
+	// Montgomery Product
+	Integer ModContext::montgomery_product(const Integer& a, const Integer& b) const {
+		BlockVector t(2 * _n + 1);
+		Integer::mul_blocks(t.data(), a.num.data(), a.num.size(), b.num.data(), b.num.size());
 
-		for (int i = 0; i < len; ++i) {
-			BLOCK_PRODUCT prod = num[i] * (BLOCK_PRODUCT)n + carry;
+		Integer r;
+		redc(t, r);
+		return r;
+	}
 
-			if (prod > MAX || prod < -MAX) {	// Overflow fix
-				carry = prod / BASE;
-				prod %= BASE;
-			}
-			else { carry = 0; }
 
-			result.num[i] = prod;
+	// Montgomery Reduction
+	void ModContext::redc(BlockVector& t, Integer& r) const {
+		// Adding u * modulus * 2^(32i) clears block i, after n rounds t is divisible by R
+		for (size_t i = 0; i < _n; ++i) {
+			BLOCK u = t[i] * _m_inv;
+			Integer::addmul_blocks(t.data() + i, t.size() - i, _modulus.num.data(), _n, &u, 1, false);
 		}
 
-		if (carry > 0) { result.num.push_back(carry); }	// Append any hanging carry
+		// t / R < 2 * modulus
+		r.num.assign(t.data() + _n, t.data() + t.size());
+		r.sign = false;
+		r.tweak_blocks();
+		if (r >= _modulus) { r -= _modulus; }
+	}
 
-		result.tweak_blocks();
-		result.sign = (result.num.size() == 1 && result.num[0] == 0) ? false : (sign != n < 0);
 
-		return result;
+	// Barrett Reduction
+	Integer ModContext::barrett(const Integer& x) const {
+		// q = floor(floor(x / 2^(32(n - 1))) * mu / 2^(32(n + 1))) is at most two short of floor(x / modulus)
+		Integer q = ((x >> (int)(BITS * (_n - 1))) * _mu) >> (int)(BITS * (_n + 1));
+		Integer r = x - q * _modulus;
+
+		while (r >= _modulus) { r -= _modulus; }
+		return r;
 	}
 
 
-	// Division overload
-	Integer Integer::operator/(const Integer& o) const {
+	// Reduced
+	bool ModContext::reduced(const Integer& x) const {
+		return !x.sign && x < _modulus;
+	}
 
-		// Division by zero exception
-		if (o.num.size() == 1 && o.num[0] == 0) {
-			throw IntegerException("Division by zero");
+
+	// Require Montgomery
+	void ModContext::require_montgomery() const {
+		if (!montgomery()) {
+			throw IntegerException("Montgomery form needs an odd modulus");
 		}
+	}
 
 
-		// Declare the denominator(+), numerator(+), quotient, and remainder
-		Integer denom = (o.sign ? -o : o), numer = (sign ? -*this : *this), quotient, remain;
+	////////////////
+	// ThreadPool //
+	////////////////
 
-		quotient.num.resize(numer.num.size(), 0);
+	// Constructor (primary)
+	ThreadPool::ThreadPool(unsigned threads) : _queued(0), _stop(false) {
+		size_t workers = threads > 1 ? threads - 1 : 0;
+		for (size_t i = 0; i <= workers; ++i) { _queues.push_back(std::make_unique<Queue>()); }
 
-		for (int i = numer.num.size() - 1; i > -1; --i) {
-			remain.num.insert(remain.num.begin(), numer.num[i]);
-			remain.tweak_blocks();
-			BLOCK count = denominator_in_remainder(remain, denom);
-			remain -= denom * count;
-			quotient.num[i] += count;
+		_workers.reserve(workers);
+		for (size_t i = 0; i < workers; ++i) {
+			_workers.emplace_back([this, i]() { work(i); });
 		}
+	}
 
-		quotient.tweak_blocks();
 
-		quotient.sign = (quotient.num.size() == 1 && quotient.num[0] == 0) ? false : (sign != o.sign);
+	// Deconstructor
+	ThreadPool::~ThreadPool() {
+		{
+			std::lock_guard<std::mutex> guard(_idle_lock);
+			_stop = true;
+		}
+		_idle.notify_all();
 
-		return quotient;
+		for (std::thread& worker : _workers) { worker.join(); }
 	}
 
 
-	// Modulo overload
-	Integer Integer::operator%(const Integer& o) const {
+	// Fork
+	template <class F>
+	void ThreadPool::fork(size_t n, const F& f) {
+		if (n == 0) { return; }
 
-		// Division by zero exception
-		if (o.num.size() == 1 && o.num[0] == 0) {
-			throw IntegerException("Division by zero");
-		}
+		Join join;
+		join.pending.store(n, std::memory_order_relaxed);
+		for (size_t i = 1; i < n; ++i) { push(Task{ &call<F>, &f, i, &join }); }
 
-		// Declare the denominator(+), numerator(+), and remainder
-		Integer denom = (o.sign ? -o : o), numer = (sign ? -*this : *this), remain;
+		run(Task{ &call<F>, &f, 0, &join });
 
-		for (int i = numer.num.size() - 1; i > -1; --i) {
-			remain.num.insert(remain.num.begin(), numer.num[i]);
-			remain.tweak_blocks();
-			BLOCK count = denominator_in_remainder(remain, denom);
-			remain -= denom * count;
+		// Help out until the rest is done, whatever task that turns out to be
+		while (join.pending.load(std::memory_order_acquire) > 0) {
+			Task task;
+			if (pop(task)) { run(task); }
+			else { std::this_thread::yield(); }
 		}
 
-		remain.tweak_blocks();
+		if (join.error) { std::rethrow_exception(join.error); }
+	}
+
 
-		remain.sign = (remain.num.size() == 1 && remain.num[0] == 0) ? false : (sign != o.sign);
+	// Push (onto the calling thread's queue)
+	void ThreadPool::push(const Task& task) {
+		Queue& queue = *_queues[_current == this ? _current_index : _queues.size() - 1];
+		_queued.fetch_add(1, std::memory_order_release);	// Counted first, so pop() never takes it below zero
+		{
+			std::lock_guard<std::mutex> guard(queue.lock);
+			queue.tasks.push_back(task);
+		}
 
-		return remain;
+		// Taking the lock orders the push before a worker's check, so the wake up is not lost
+		{ std::lock_guard<std::mutex> guard(_idle_lock); }
+		_idle.notify_one();
 	}
 
 
-	// Addition & Assignment Overload
-	const Integer& Integer::operator+=(const Integer& o) {
-		size_t len = num.size();
-		if (o.num.size() > len) {
-			len = o.num.size();
-			num.resize(len, 0);
-		}
+	// Pop (the newest task of the own queue, else steal the oldest of another)
+	bool ThreadPool::pop(Task& task) {
+		if (_queued.load(std::memory_order_acquire) == 0) { return false; }
 
-		for (int i = 0; i < len; ++i) {
-			num[i] = (i < num.size() ? (sign ? -num[i] : num[i]) : 0) + (i < o.num.size() ? (o.sign ? -o.num[i] : o.num[i]) : 0);
-		}
+		size_t own = _current == this ? _current_index : _queues.size() - 1;
+		for (size_t k = 0; k < _queues.size(); ++k) {
+			Queue& queue = *_queues[(own + k) % _queues.size()];
+			std::lock_guard<std::mutex> guard(queue.lock);
+			if (queue.tasks.empty()) { continue; }
 
-		tweak_blocks();
+			if (k == 0) {
+				task = queue.tasks.back();
+				queue.tasks.pop_back();
+			}
+			else {
+				task = queue.tasks.front();
+				queue.tasks.pop_front();
+			}
 
-		return *this;
+			_queued.fetch_sub(1, std::memory_order_relaxed);
+			return true;
+		}
+
+		return false;
 	}
 
 
-	// Subtraction & Assignment Overload
-	const Integer& Integer::operator-=(const Integer& o) {
-		size_t len = num.size();
-		if (o.num.size() > len) {
-			len = o.num.size();
-			num.resize(len, 0);
+	// Run
+	void ThreadPool::run(const Task& task) {
+		try {
+			task.call(task.f, task.index);
 		}
-
-		for (int i = 0; i < len; ++i) {
-			num[i] = (i < num.size() ? (sign ? -num[i] : num[i]) : 0) - (i < o.num.size() ? (o.sign ? -o.num[i] : o.num[i]) : 0);
+		catch (...) {
+			std::lock_guard<std::mutex> guard(task.join->lock);
+			if (!task.join->error) { task.join->error = std::current_exception(); }
 		}
 
-		tweak_blocks();
-
-		return *this;
+		task.join->pending.fetch_sub(1, std::memory_order_release);
 	}
 
 
-	// Multiplication & Assignment Overload (Object)
-	const Integer& Integer::operator*=(const Integer& o) {
-		// Cant think of an encompassing method of in place multiplication
+	// Work (the loop of worker index)
+	void ThreadPool::work(size_t index) {
+		_current = this;
+		_current_index = index;
 
-		*this = *this * o;
+		while (true) {
+			Task task;
+			if (pop(task)) {
+				run(task);
+				continue;
+			}
 
-		return *this;
+			std::unique_lock<std::mutex> lock(_idle_lock);
+			_idle.wait(lock, [this]() { return _stop || _queued.load(std::memory_order_acquire) > 0; });
+			if (_stop && _queued.load(std::memory_order_acquire) == 0) { return; }
+		}
 	}
 
 
-	// Multiplication & Assignment Overload (Block)
-	const Integer& Integer::operator*=(BLOCK n) {
-		// Cant think of an encompassing method of in place multiplication
-
-		*this = *this * n;
+	////////////////
+	// Non Member //
+	////////////////
 
-		return *this;
+	// Division & Remainder
+	IntegerDiv divmod(const Integer& n, const Integer& d, Rounding mode) {
+		IntegerDiv result;
+		divmod(n, d, result.quot, result.rem, mode);
 
+		return result;
 	}
 
 
-	// Division & Assignment Overload
-	const Integer& Integer::operator/=(const Integer& o) {
-		// Cant think of an encompassing method of in place division
+	// Division & Remainder (In Place)
+	void divmod(const Integer& n, const Integer& d, Integer& quot, Integer& rem, Rounding mode) {
 
-		*this = *this / o;
+		// Division by zero exception
+		if (d.num.size() == 1 && d.num[0] == 0) {
+			throw IntegerException("Division by zero");
+		}
 
-		return *this;
+		// The outputs are written before n and d are done being read, so aliases go through a copy
+		if (&quot == &n || &quot == &d || &rem == &n || &rem == &d) {
+			IntegerDiv result;
+			divmod(n, d, result.quot, result.rem, mode);
 
-	}
+			quot = result.quot;
+			rem = result.rem;
+			return;
+		}
 
+		Integer::divmod_magnitude(quot, rem, n, d);
 
-	// Modulo & Assignment Overload
-	const Integer& Integer::operator%=(const Integer& o) {
-		// Cant think of an encompassing method of in place modulo
+		// Truncated division, quotient towards zero and the remainder takes the sign of the numerator
+		quot.sign = n.sign != d.sign;
+		rem.sign = n.sign;
+		quot.tweak_blocks();
+		rem.tweak_blocks();
 
-		*this = *this % o;
+		// Any other rounding is at most one step away from truncation
+		bool inexact = !(rem.num.size() == 1 && rem.num[0] == 0);
+		if (!inexact) { return; }
 
-		return *this;
+		bool down = false, up = false;
+		switch (mode) {
+		case Rounding::TRUNCATE:	break;
+		case Rounding::FLOOR:		down = rem.sign != d.sign; break;
+		case Rounding::CEIL:		up = rem.sign == d.sign; break;
+		case Rounding::EUCLIDEAN:	down = rem.sign && !d.sign, up = rem.sign && d.sign; break;
+		}
 
+		if (down) {
+			--quot;
+			rem += d;
+		}
+		else if (up) {
+			++quot;
+			rem -= d;
+		}
 	}
 
 
-	// Unary Negative
-	Integer Integer::operator-() const {
-		Integer result = *this;
-		result.sign = !sign;
-
-		return result;
-	}
-
+	// Power
+	Integer pow(const Integer& base, const Integer& exp) {
+		if (exp.sign) {
+			throw IntegerException("Cannot raise base to a negative number");
+		}
 
-	// Pre-increment
-	Integer Integer::operator++(int) {
-		Integer result = *this;
-		result.num[0] += (sign ? -1 : 1);
+		Integer result = 1;
+		if (exp == 0) { return result; }
+		if (base == 0) { return base; }
+
+		// base = m * 2^zeros, so base^exp = m^exp << (zeros * exp). Powers of 2 (and of BASE) are just the shift
+		size_t zeros = 0;
+		while (base.num[zeros / BITS] == 0) { zeros += BITS; }
+		while (((base.num[zeros / BITS] >> (zeros % BITS)) & 1) == 0) { ++zeros; }
+		Integer m = base >> (int)zeros;
+		m.sign = false;
+
+		if (zeros > 0 && (exp.num.size() > 1 || (unsigned long long)exp.num[0] * zeros > INT_MAX)) {
+			throw IntegerException("Power is too large");
+		}
 
-		result.tweak_blocks();
+		// Left to right binary exponentiation, a square per bit and a multiply by m per set bit
+		if (m != 1) {
+			size_t top = exp.num.size() * BITS - Integer::leading_zeros(exp.num.back());
+			result.num = m.num;
 
-		return result;
-	}
+			for (size_t i = top - 1; i-- > 0;) {
+				result *= result;
+				if ((exp.num[i / BITS] >> (i % BITS)) & 1) { result *= m; }
+			}
+		}
 
-	// Pre-decrement
-	Integer Integer::operator--(int) {
-		Integer result = *this;
-		result.num[0] -= (sign ? -1 : 1);
+		result.sign = base.sign && (exp.num[0] & 1);	// Odd powers keep the sign
 
-		result.tweak_blocks();
+		if (zeros > 0) { result <<= (int)(exp.num[0] * zeros); }
 
 		return result;
 	}
 
-	// Post-increment
-	const Integer& Integer::operator++() {
-		num[0] += (sign ? -1 : 1);
-		tweak_blocks();
 
-		return *this;
+	// Power (Primitive)
+	Integer pow(int base, int exp) {
+		return pow(Integer(base), Integer(exp));
 	}
 
-	// Post-decrement
-	const Integer& Integer::operator--() {
-		num[0] -= (sign ? -1 : 1);
-		tweak_blocks();
 
-		return *this;
+	// Power (Object)
+	Integer pow(const Integer& base, int exp) {
+		return pow(base, Integer(exp));
 	}
 
 
-	// Bitwise And Overload
-	Integer Integer::operator&(Integer& o) {
-		std::string result = "";
-		std::string bin = get_binary();
-		std::string o_bin = o.get_binary();
+	// Greatest Common Divisor
+	Integer gcd(const Integer& a, const Integer& b) {
+		// Native words for the common small case
+		if (a.num.size() <= 2 && b.num.size() <= 2) {
+			BLOCK_PRODUCT x = a.num[0] | (a.num.size() > 1 ? (BLOCK_PRODUCT)a.num[1] << BITS : 0);
+			BLOCK_PRODUCT y = b.num[0] | (b.num.size() > 1 ? (BLOCK_PRODUCT)b.num[1] << BITS : 0);
+			while (y != 0) {
+				BLOCK_PRODUCT r = x % y;
+				x = y, y = r;
+			}
 
-		while (bin.length() < o_bin.length()) {
-			bin = "0" + bin;
-		}
-		while (o_bin.length() < bin.length()) {
-			o_bin = "0" + o_bin;
+			return Integer((unsigned long long)x);
 		}
 
-		for (int i = 0; i < bin.length(); ++i) {
-			if (bin[i] == '1' && o_bin[i] == '1') {
-				result += "1";
-			}
-			else {
-				result += "0";
-			}
-		}
+		Integer x = a, y = b;
+		x.sign = y.sign = false;
+		if (x < y) { std::swap(x, y); }
 
-		return from_binary(result);
+		Integer::gcd_magnitude(x, y, nullptr);
+		return x;
 	}
 
-	// Bitwise Or Overload
-	Integer Integer::operator|(Integer& o) {
-		std::string result = "";
-		std::string bin = get_binary();
-		std::string o_bin = o.get_binary();
-
-		while (bin.length() < o_bin.length()) {
-			bin = "0" + bin;
-		}
-		while (o_bin.length() < bin.length()) {
-			o_bin = "0" + o_bin;
-		}
 
-		for (int i = 0; i < bin.length(); ++i) {
-			if (bin[i] == '1' || o_bin[i] == '1') {
-				result += "1";
-			}
-			else {
-				result += "0";
-			}
-		}
+	// Least Common Multiple
+	Integer lcm(const Integer& a, const Integer& b) {
+		if (a == 0 || b == 0) { return Integer(); }
 
-		return from_binary(result);
+		Integer result = a / gcd(a, b) * b;
+		if (result < 0) { result = -std::move(result); }
+		return result;
 	}
 
 
-	// Bitwise Xor Overload
-	Integer Integer::operator^(Integer& o) {
-		std::string result = "";
-		std::string bin = get_binary();
-		std::string o_bin = o.get_binary();
+	// Extended GCD
+	IntegerGCD xgcd(const Integer& a, const Integer& b) {
+		Integer x = a, y = b;
+		x.sign = y.sign = false;
+		bool swapped = x < y;
+		if (swapped) { std::swap(x, y); }
 
-		while (bin.length() < o_bin.length()) {
-			bin = "0" + bin;
-		}
-		while (o_bin.length() < bin.length()) {
-			o_bin = "0" + o_bin;
-		}
+		// gcd = m00 * x + m01 * y
+		Integer::Cofactors t;
+		Integer::gcd_magnitude(x, y, &t);
 
-		for (int i = 0; i < bin.length(); ++i) {
-			if (bin[i] == '1' != o_bin[i] == '1') {
-				result += "1";
-			}
-			else {
-				result += "0";
-			}
+		IntegerGCD result;
+		result.gcd = std::move(x);
+		result.x = swapped ? std::move(t.m01) : std::move(t.m00);
+		if (a.sign) { result.x = -std::move(result.x); }
+
+		if (b == 0) {
+			if (a == 0) { result.x = 0; }
+			result.y = 0;
+			return result;
 		}
 
-		return from_binary(result);
+		// Smallest non-negative x, then y from gcd = a * x + b * y
+		Integer period = b / result.gcd;
+		if (period < 0) { period = -std::move(period); }
+		result.x = divmod(result.x, period, Rounding::EUCLIDEAN).rem;
+		result.y = (result.gcd - a * result.x) / b;
+
+		return result;
 	}
 
 
-	// Shift Left Overload
-	Integer Integer::operator<<(int n) {
-		Integer result = *this;
+	// Modular Inverse
+	Integer invmod(const Integer& a, const Integer& m) {
+		if (m <= 0) {
+			throw IntegerException("Modulus must be positive");
+		}
 
-		while (n > 0) {
-			result /= 2;
-			--n;
+		IntegerGCD result = xgcd(a, m);
+		if (result.gcd != 1) {
+			throw IntegerException("Value has no inverse for this modulus");
 		}
 
-		return result;
+		return result.x;	// Already in [0, m)
 	}
 
 
-	// Shift Right Overload
-	Integer Integer::operator>>(int n) {
-		Integer result = *this;
-
-		while (n > 0) {
-			result *= 2;
-			--n;
+	// Square Root and Remainder
+	IntegerRoot sqrtrem(const Integer& n) {
+		if (n.sign) {
+			throw IntegerException("Cannot take an even root of a negative number");
 		}
 
+		IntegerRoot result;
+		Integer::sqrt_magnitude(result.root, result.rem, n);
 		return result;
 	}
 
 
-	//  Get Length (Chunk)
-	unsigned int Integer::getLength() {
-		return num.size();
+	// Integer Square Root
+	Integer isqrt(const Integer& n) {
+		return sqrtrem(n).root;
 	}
 
 
-	// Get Length (Digits)
-	unsigned int Integer::getDigitLength() {
-		int digits = 0;
-		for (int i = 0; i < num.size() - 1; ++i) {
-			digits += 9;
+	// Integer Root
+	Integer iroot(const Integer& n, size_t k) {
+		if (k == 0) {
+			throw IntegerException("Cannot take the 0th root");
 		}
-
-		int n = num[num.size() - 1];
-		while (n > 0) {
-			n %= 10;
-			++digits;
+		if (n.sign && k % 2 == 0) {
+			throw IntegerException("Cannot take an even root of a negative number");
 		}
+		if (k == 1) { return n; }
 
-		return digits;
-	}
+		Integer m = n, root, rem;
+		m.sign = false;
+		if (k == 2) { Integer::sqrt_magnitude(root, rem, m); }
+		else { root = Integer::root_magnitude(m, k); }
 
-	// Get Chunk
-	unsigned int Integer::getChunk(unsigned int n) {
-		return num[n];
+		root.sign = n.sign;	// Odd roots keep the sign (|n| >= 1, so root != 0)
+		return root;
 	}
 
 
+	// Perfect Power
+	bool is_perfect_power(const Integer& n) {
+		Integer base;
+		size_t exp;
+		return is_perfect_power(n, base, exp);
+	}
 
 
-
-	// Construct From String
-	void Integer::construct_from_string(std::string str) {
-		if (str[0] == '-') {
-			sign = 1;			// Negative check
-			str = str.substr(1);
+	// Perfect Power (Base and Exponent)
+	bool is_perfect_power(const Integer& n, Integer& base, size_t& exp) {
+		Integer m = n;
+		m.sign = false;
+		if (m <= 1) {
+			exp = n.sign ? 3 : 2;
+			base = n;
+			return true;
 		}
-		else { sign = 0; }
 
-		// Remove leading zeros
-		while (str[0] == '0') { str = str.substr(1); }
-		if (str == "") { str = "0"; }	// Zero fix
+		// Exact roots by each prime p, for as long as they are exact, give the largest exponent of |n|.
+		// A root of 2 or more needs at least p + 1 bits
+		size_t bits = Integer::bit_length(m);
+		std::vector<bool> composite(bits + 1, false);
+		exp = 1;
+		for (size_t p = 2; p < Integer::bit_length(m); ++p) {
+			if (composite[p]) { continue; }
+			for (size_t q = p * p; q <= bits; q += p) { composite[q] = true; }
 
+			while (p < Integer::bit_length(m) && Integer::exact_root(m, p)) { exp *= p; }
+		}
 
-		// No overhangs
-		int i = str.length() - DIGITS;
-		if (i > 0) {
-			while (i >= 0) {
-				num.push_back(std::stoi(str.substr(i, 9)));
-				str = str.substr(0, i);
-				i -= DIGITS;
+		// A negative value needs an odd exponent, the factors of 2 go back into the base
+		if (n.sign) {
+			while (exp % 2 == 0) {
+				m *= m;
+				exp /= 2;
 			}
+			m.sign = true;
 		}
-		else {
-			num.push_back(std::stoi(str));
-			str = "";
-		}
 
+		base = std::move(m);
+		return exp > 1;
+	}
+
+
+	// Probable Prime
+	bool is_probable_prime(const Integer& n, size_t rounds) {
+		if (n.sign || n < 2) { return false; }
 
-		// Remaining overhangs
-		if (str.length() > 0) {
-			num.push_back(std::stoi(str.substr(0, i + DIGITS)));
+		// Small values are looked up, the rest divided by the small primes first
+		const std::vector<BLOCK>& primes = Integer::small_primes();
+		if (n.num.size() == 1 && n.num[0] < TRIAL_DIVISION_LIMIT) {
+			return std::binary_search(primes.begin(), primes.end(), n.num[0]);
 		}
-	}
 
+		size_t count = std::lower_bound(primes.begin(), primes.end(), (BLOCK)TRIAL_DIVISION_LIMIT) - primes.begin();
+		std::vector<BLOCK> residues(count);
+		Integer::prime_residues(n, count, residues.data());
+		if (std::find(residues.begin(), residues.end(), 0) != residues.end()) { return false; }
 
-	// Tweak Blocks
-	void Integer::tweak_blocks() {
+		if (n.num.size() == 1 && n.num[0] < TRIAL_DIVISION_LIMIT * TRIAL_DIVISION_LIMIT) { return true; }
+		return Integer::probable_prime(n, rounds);
+	}
 
 
-		/**
-		* Borrow / Carry
-		*/
-		for (int i = 0; i < num.size(); ++i) {
-			if (num[i] > MAX || num[i] < -MAX) {
-				if (i + 1 >= num.size()) {
-					// Push back the carried block
-					num.push_back(num[i] / BASE);
-				}
-				else {
-					// Add the carry to the next index
-					num[i + 1] += num[i] / BASE;
-				}
+	// Probable Primes (Batch)
+	void is_probable_prime(const Integer* values, size_t count, bool* results, size_t rounds, unsigned threads) {
+		if (threads == 0) { threads = std::max(1u, std::thread::hardware_concurrency()); }
+		threads = (unsigned)std::min<size_t>(threads, count);
 
-				// Truncate the overflowed chunk
-				num[i] %= BASE;
+		// Values are handed out one at a time, as composites mostly fail fast and primes run every test
+		std::atomic<size_t> next(0);
+		auto work = [&](size_t) {
+			try {
+				for (size_t i; (i = next.fetch_add(1)) < count;) { results[i] = is_probable_prime(values[i], rounds); }
 			}
-		}
+			catch (...) {
+				next.store(count);	// The others stop after their current value, fork() rethrows
+				throw;
+			}
+		};
 
+		if (threads <= 1) {
+			work(0);
+			return;
+		}
 
-		/**
-		* Fix any mismatched chunks
-		* Depending on what operation preceded the execution of this function
-		* many or all of the chunks may be negative and that breaks the storage
-		* norm and all functionality
-		*/
-		bool is_signed = false;
-		int i = num.size() - 1;
-		while (i > -1) {
-			if (num[i] != 0) {	// Set precedent for which side of the fix
-				is_signed = num[i--] < 0;
-				break;
-			}
-			--i;
+		// The multiply pool when it has the size asked for, otherwise one just for this batch
+		std::unique_ptr<ThreadPool> local;
+		ThreadPool* pool = multiply_pool();
+		if (!pool || pool->size() != threads) {
+			local = std::make_unique<ThreadPool>(threads);
+			pool = local.get();
 		}
 
-		// Yes I tried to ternary this, no I don't want to talk about it
+		pool->fork(threads, work);
+	}
 
-		if (is_signed) {			// Negtative fix
-			while (i > -1) {		// Loop across remaining blocks (less signifigant)
-				if (num[i] > 0) {
-					int ii = i + 1, iii = 0;	// Next index and offset
 
-					while (ii < num.size() && num[ii] == 0) {	// Loop across remaining (more signifigant)
+	// Next Prime
+	Integer next_prime(const Integer& n) {
+		const std::vector<BLOCK>& primes = Integer::small_primes();
+		if (n < primes.back()) {
+			return Integer((unsigned long long)*std::upper_bound(primes.begin(), primes.end(), n < 0 ? 0 : n.num[0]));
+		}
 
-						++num[ii];
-						num[i] -= BASE;
+		// Odd candidates start + 2i, with a window of them sieved by every small prime at once: p divides
+		// start + 2i when i == -start / 2 (mod p). Only the survivors are tested
+		Integer start = n + 1;
+		if ((start.num[0] & 1) == 0) { ++start; }
+
+		size_t window = 256 + 2 * Integer::bit_length(n);
+		std::vector<BLOCK> residues(primes.size());
+		std::vector<bool> composite(window);
+		while (true) {
+			Integer::prime_residues(start, primes.size(), residues.data());
+			std::fill(composite.begin(), composite.end(), false);
+			for (size_t i = 1; i < primes.size(); ++i) {
+				BLOCK_PRODUCT p = primes[i];
+				for (size_t j = (size_t)((p - residues[i]) % p * ((p + 1) / 2) % p); j < window; j += p) { composite[j] = true; }
+			}
 
-						while (iii > 0) {			// Flip sign
-							num[i + iii] = -MAX;
-							--iii;
-						}
+			for (size_t i = 0; i < window; ++i) {
+				if (composite[i]) { continue; }
 
-						++ii, ++iii;
-					}
-				}
-				--i;
+				Integer candidate = start + Integer((unsigned long long)(2 * i));
+				if (Integer::probable_prime(candidate, 0)) { return candidate; }
 			}
-		}
-		else {	// Positive fix
-			while (i > -1) {		// Loop across remaining blocks (less signifigant)
-				if (num[i] < 0) {
-					int ii = i + 1, iii = 0;	// Next index and offset
 
-					while (ii < num.size() && num[ii] == 0) {	// Loop acros remaining (more signifigant)
-
-						--num[ii];
-						num[i] += BASE;
+			start += Integer((unsigned long long)(2 * window));
+		}
+	}
 
-						while (iii > 0) {			// Flip sign
-							num[i + iii] = MAX;
-							--iii;
-						}
 
-						++ii, ++iii;
-					}
-				}
-				--i;
-			}
+	// Random Prime
+	Integer random_prime(size_t bits) {
+		if (bits < 2) {
+			throw IntegerException("A prime needs at least 2 bits");
 		}
 
+		// A random start with the top bit set, then the next prime if it still has bits bits
+		Integer top = Integer(1) << (int)(bits - 1);
+		while (true) {
+			Integer x = random_bits(bits - 1) + top;
 
-		if (is_signed) {
-			sign = !sign;
-			for (int i = 0; i < num.size(); ++i) {
-				num[i] = abs(num[i]);
-			}
-		}
-		else {
-			sign = sign;	// Doesnt change
+			Integer p = next_prime(x - 1);
+			if (Integer::bit_length(p) == bits) { return p; }
 		}
+	}
 
 
-		trim_leading();	// Trim any remaining leading zeros
+	// Random Engine
+	std::mt19937_64& random_engine() {
+		thread_local std::mt19937_64 engine(((BLOCK_PRODUCT)std::random_device()() << BITS) | std::random_device()());
+		return engine;
 	}
 
 
-	// Trim Leading (zeros)
-	void Integer::trim_leading() {
-		int i = num.size() - 1;
-		while (i > 0) {
-			if (num[i] == 0) {
-				num.erase(num.begin() + i);
-			}
-			else { return; } // Skip the rest
-			--i;
-		}
+	// Random Bits
+	template <class Engine>
+	Integer random_bits(size_t bits, Engine& engine) {
+		Integer r;
+		Integer::fill_bits(r, bits, engine);
+		return r;
 	}
 
-	// Small helper for the division/modulo helper
-	div_t quot_and_rem(int num, int den) {
-		div_t result;
-		result.quot = num / den;
-		result.rem = num % den;
-		return result;
+
+	// Random Bits (Thread Engine)
+	Integer random_bits(size_t bits) {
+		return random_bits(bits, random_engine());
 	}
 
-	// Denominator In Remainder
-	BLOCK Integer::denominator_in_remainder(const Integer& rem, const Integer& den) {
-		BLOCK min = 0, max = MAX;
 
-		while (max > min) {
-			div_t test = quot_and_rem(min + max, 2);
-			BLOCK avg = (test.rem) ? (test.quot + 1) : test.quot;
+	// Random (range)
+	template <class Engine>
+	Integer random(const Integer& min, const Integer& max, Engine& engine) {
+		Integer r;
+		random(&r, 1, min, max, engine);
+		return r;
+	}
 
-			// Hanging on max = (min + 1)
 
-			Integer product = den * avg;
+	// Random (range, Thread Engine)
+	Integer random(const Integer& min, const Integer& max) {
+		return random(min, max, random_engine());
+	}
 
-			if (rem == product) { return avg; }
-			else if (rem > product) { min = avg; }
-			else { max = avg - 1; }
 
+	// Random (Bulk)
+	template <class Engine>
+	void random(Integer* out, size_t count, const Integer& min, const Integer& max, Engine& engine) {
+		if (max <= min) {
+			throw IntegerException("Maximum random value must exceed the minimum");
 		}
 
-		return min;
+		// Rejection sampling: draws of (range - 1)'s bit length are uniform below a power of 2 that is less than
+		// twice the range, so each value takes under two draws on average and is exactly uniform
+		Integer range = max - min;
+		size_t bits = Integer::bit_length(range - 1);
+		for (size_t i = 0; i < count; ++i) {
+			do { Integer::fill_bits(out[i], bits, engine); } while (out[i] >= range);
+			out[i] += min;
+		}
 	}
 
 
-	// Get Binary
-	std::string Integer::get_binary() {
-		std::string bin = "";
-		Integer num = *this;
+	// Random (Bulk, Thread Engine)
+	void random(Integer* out, size_t count, const Integer& min, const Integer& max) {
+		random(out, count, min, max, random_engine());
+	}
 
-		Integer power = 1;
-		while (power <= num) {
-			power *= 2;
-		}
 
-		while (power > 0) {
-			if (power <= num) {
-				num -= power;
-				bin += "1";
-			}
-			else {
-				bin += "0";
-			}
-			power /= 2;
-		}
+	// Product
+	template <class Iterator>
+	Integer product(Iterator first, Iterator last) {
+		Integer result = 1;
+		size_t n = std::distance(first, last);
+		if (n > 0) { Integer::reduce(result, first, n, 1, [](Integer& r, const auto& x) { r *= x; }, multiply_pool()); }
 
-		// Trim any leading zeros
-		int offset = bin.find('1');
-		return bin.substr(offset);
+		return result;
 	}
 
 
-	// From Binary
-	Integer Integer::from_binary(const std::string& str) {
-		Integer num = 0;
-		Integer power = 1;
+	// Product (Range)
+	template <class Range>
+	Integer product(const Range& values) {
+		return product(std::begin(values), std::end(values));
+	}
 
-		for (int i = str.length() - 1; i > -1; --i) {
-			if (str[i] == '1') {
-				num += power;
 
-			}
-			power *= 2;
-		}
+	// Sum
+	template <class Iterator>
+	Integer sum(Iterator first, Iterator last) {
+		Integer result;
+		size_t n = std::distance(first, last);
+		if (n > 0) { Integer::reduce(result, first, n, REDUCE_GRAIN, [](Integer& r, const auto& x) { r += x; }, multiply_pool()); }
 
-		return num;
+		return result;
 	}
 
-	////////////////
-	// Non Member //
-	////////////////
-
-	// Power (Primitive)
-	Integer pow(int base, int exp) {
-		if (exp < 0) {
-			throw IntegerException("Cannot raise base to a negative number");
-		}
-		else if (exp == 0 || base == 1) { return Integer(1); }
-		Integer result = 1;
-
-		while (exp > 0) {
-			result *= base;
-			--exp;
-		}
 
-		return result;
+	// Sum (Range)
+	template <class Range>
+	Integer sum(const Range& values) {
+		return sum(std::begin(values), std::end(values));
 	}
 
+#ifdef BIGINT_EXECUTION
 
-	// Power (Object)
-	Integer pow(const Integer& base, int exp) {
-		if (exp < 0) {
-			throw IntegerException("Cannot raise base to a negative number");
-		}
-		else if (exp == 0 || base == 1) { return Integer(1); }
+	// Product (Execution Policy)
+	template <class Policy, class Iterator>
+	std::enable_if_t<std::is_execution_policy_v<std::decay_t<Policy>>, Integer> product(Policy&&, Iterator first, Iterator last) {
 		Integer result = 1;
+		size_t n = std::distance(first, last);
+		if (n == 0) { return result; }
 
-		while (exp > 0) {
-			result *= base;
-			--exp;
-		}
+		std::unique_ptr<ThreadPool> local;
+		ThreadPool* pool = std::is_same_v<std::decay_t<Policy>, std::execution::sequenced_policy> ? nullptr : Integer::reduction_pool(local);
+		Integer::reduce(result, first, n, 1, [](Integer& r, const auto& x) { r *= x; }, pool);
 
 		return result;
 	}
 
-	// Random (range)
-	Integer random(big::Integer min, big::Integer max) {
-		if (max < min) {
-			throw IntegerException("Maximum random value cannot exceed the specified minimum");
-		}
 
-		std::random_device rd;
-		std::mt19937 gen(rd());
-		Integer random_big;
+	// Product (Execution Policy, Range)
+	template <class Policy, class Range>
+	std::enable_if_t<std::is_execution_policy_v<std::decay_t<Policy>>, Integer> product(Policy&& policy, const Range& values) {
+		return product(std::forward<Policy>(policy), std::begin(values), std::end(values));
+	}
 
-		// Negative number check?
-		bool negative = false;
-		Integer offset = -min;
-		if (min < 0) { 
-			negative = true;
-			min += offset, max += offset; 
-		}
 
-		int min_size = min.getLength(), max_size = max.getLength();
+	// Sum (Execution Policy)
+	template <class Policy, class Iterator>
+	std::enable_if_t<std::is_execution_policy_v<std::decay_t<Policy>>, Integer> sum(Policy&&, Iterator first, Iterator last) {
+		Integer result;
+		size_t n = std::distance(first, last);
+		if (n == 0) { return result; }
 
-		for (int i = 0; i < max_size; ++i) {
-			int min_rand = 0, max_rand = BASE;
-			if (i == (min_size - 1)) {
-				min_rand = min.getChunk(i);
-			}
-			if (i == (max_size - 1)) {
-				max_rand = max.getChunk(i);
-			}
+		std::unique_ptr<ThreadPool> local;
+		ThreadPool* pool = std::is_same_v<std::decay_t<Policy>, std::execution::sequenced_policy> ? nullptr : Integer::reduction_pool(local);
+		Integer::reduce(result, first, n, REDUCE_GRAIN, [](Integer& r, const auto& x) { r += x; }, pool);
 
-			std::uniform_int_distribution<> dist(min_rand, max_rand - 1);
-			Integer rand_block = dist(gen);
-			random_big += rand_block * ((i > 0) ? (BASE * (i)) : 1);
-		}
+		return result;
+	}
 
-		if (negative) { random_big -= offset; }
-		return random_big;
 
+	// Sum (Execution Policy, Range)
+	template <class Policy, class Range>
+	std::enable_if_t<std::is_execution_policy_v<std::decay_t<Policy>>, Integer> sum(Policy&& policy, const Range& values) {
+		return sum(std::forward<Policy>(policy), std::begin(values), std::end(values));
 	}
+#endif
 }
 
 